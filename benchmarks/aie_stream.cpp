@@ -0,0 +1,71 @@
+/* Measure the bandwidth of the AXI streams between the tiles of the
+   AI Engine emulation
+
+   RUN: %{execute}%s
+*/
+
+// Put the tile code on fiber too to boost the performances
+#define TRISYCL_XILINX_AIE_TILE_CODE_ON_FIBER 1
+
+#include <sycl/sycl.hpp>
+
+#include <cstdint>
+#include <string>
+
+#include "include/benchmark.hpp"
+
+using namespace sycl::vendor::xilinx;
+
+// The number of values sent by each tile to its right neighbor
+// \todo do not use a global variable... Need a lambda API
+std::size_t local_transfers = 0;
+
+// Each tile sends some values to its right neighbor
+template <typename AIE, int X, int Y>
+struct right_neighbor : acap::aie::tile<AIE, X, Y> {
+  using t = acap::aie::tile<AIE, X, Y>;
+  void run() {
+    for (std::size_t i = 0; i < local_transfers; ++i) {
+      if constexpr (!t::is_east_column())
+        // There is a neighbor on the right: send some data
+        t::out(0) << static_cast<std::int32_t>(i);
+      if constexpr (!t::is_west_column()) {
+        // There is a neighbor on the left: receive some data
+        std::int32_t receive;
+        t::in(0) >> receive;
+      }
+    }
+  }
+};
+
+
+/// Measure the streams between the tiles of a device of some size
+template <typename Size>
+void measure_streams(benchmark::suite &s) {
+  using d_t = acap::aie::device<Size>;
+  d_t d;
+  // Connect each tile to its right neighbor
+  d.for_each_tile_index([&] (auto x, auto y) {
+    if (d_t::geo::is_x_y_valid(x + 1, y)) {
+      d.tile(x, y).connect(d_t::csp::me_0, d_t::cmp::east_0);
+      d.tile(x + 1, y).connect(d_t::csp::west_0, d_t::cmp::me_0);
+    }
+  });
+  local_transfers = s.operations(20'000);
+  // Each link transfers the values concurrently
+  auto links = d_t::geo::x_max*d_t::geo::y_size;
+  s.measure("stream right neighbor",
+            std::to_string(d_t::geo::x_size) + "x"
+            + std::to_string(d_t::geo::y_size) + " tiles",
+            local_transfers*links,
+            [&] { d.template run<right_neighbor>(); },
+            sizeof(std::int32_t));
+}
+
+
+int main(int argc, char *argv[]) {
+  benchmark::suite s { "aie_stream", argc, argv };
+  measure_streams<acap::aie::layout::size<2, 1>>(s);
+  measure_streams<acap::aie::layout::size<4, 4>>(s);
+  return 0;
+}
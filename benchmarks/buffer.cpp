@@ -0,0 +1,73 @@
+/* Measure the cost of the buffers and of the accessors on the host
+   device
+
+   RUN: %{execute}%s
+*/
+#include <sycl/sycl.hpp>
+
+#include <string>
+#include <vector>
+
+#include "include/benchmark.hpp"
+
+using namespace sycl;
+
+int main(int argc, char *argv[]) {
+  benchmark::suite s { "buffer", argc, argv };
+  queue q;
+
+  // The reference to isolate the accessor cost in a command group
+  s.measure_each("kernel without accessor", "", s.operations(2000), [&] {
+    q.submit([&] (handler &cgh) { cgh.single_task([] {}); });
+    q.wait();
+  });
+
+  for (std::size_t size : { 1 << 4, 1 << 12, 1 << 20 }) {
+    auto parameters = std::to_string(size) + " int";
+    auto n = s.operations(size > 4096 ? 200 : 20000);
+
+    // A buffer allocating and owning its memory
+    s.measure_each("buffer construction", parameters, n, [&] {
+      buffer<int> b { size };
+    });
+
+    // A buffer using some host memory, given back on destruction
+    std::vector<int> v(size);
+    s.measure_each("buffer from host memory", parameters, n, [&] {
+      buffer<int> b { v.data(), size };
+    });
+
+    buffer<int> b { size };
+    s.measure_each("host accessor", parameters, n, [&] {
+      auto a = b.get_access<access::mode::read_write>();
+    });
+
+    s.measure_each("kernel with accessor", parameters, n, [&] {
+      q.submit([&] (handler &cgh) {
+        auto a = b.get_access<access::mode::read_write>(cgh);
+        cgh.single_task([=] { a[0] = 1; });
+      });
+      q.wait();
+    });
+  }
+
+  /* A kernel on row-major and column-major data, iterated in the
+     memory order of the buffers */
+  constexpr std::size_t side = 2048;
+  std::vector<float> matrix(side*side);
+  auto measure_layout = [&] (auto layout, std::string name) {
+    using extents = std::dextents<std::size_t, 2>;
+    buffer b { std::mdspan<float, extents, decltype(layout)> {
+        matrix.data(), extents { side, side } } };
+    s.measure_each("parallel_for on layout", name, s.operations(20), [&] {
+      q.submit([&] (handler &cgh) {
+        auto a = b.template get_access<access::mode::read_write>(cgh);
+        cgh.parallel_for(b.get_range(), [=] (id<2> i) { a[i] += 1; });
+      });
+      q.wait();
+    }, 2*side*side*sizeof(float));
+  };
+  measure_layout(std::layout_right {}, "layout_right");
+  measure_layout(std::layout_left {}, "layout_left");
+  return 0;
+}
@@ -0,0 +1,54 @@
+/* Measure the latency of the submission of work to the fiber_pool
+   executor used by the AI Engine emulation
+
+   RUN: %{execute}%s
+*/
+#include <algorithm>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "triSYCL/detail/fiber_pool.hpp"
+
+#include "include/benchmark.hpp"
+
+using fiber_pool = trisycl::detail::fiber_pool;
+
+int main(int argc, char *argv[]) {
+  benchmark::suite s { "fiber_pool", argc, argv };
+  auto n = s.operations(5000);
+  auto max_threads =
+    static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+  for (auto [scheduler, name] :
+         { std::pair { fiber_pool::sched::round_robin, "round_robin" },
+           std::pair { fiber_pool::sched::shared_work, "shared_work" },
+           std::pair { fiber_pool::sched::work_stealing, "work_stealing" } })
+    // Use a single thread and then all the hardware threads, since
+    // an oversubscription only measures the operating system
+    for (int threads : std::set { 1, max_threads }) {
+      fiber_pool fp { threads, scheduler, true };
+      auto parameters = std::string { name } + ", "
+        + std::to_string(threads) + " threads";
+
+      // The round trip of a work to a fiber and back
+      s.measure_each("submit+get", parameters, n, [&] {
+        fp.submit([] {}).get();
+      });
+
+      // The submission of many works waited for at the end
+      std::vector<fiber_pool::future<void>> futures;
+      futures.reserve(n);
+      s.measure("submit", parameters + ", batch", n, [&] {
+        futures.clear();
+        for (std::size_t i = 0; i < n; ++i)
+          futures.push_back(fp.submit([] {}));
+        for (auto &f : futures)
+          f.get();
+      });
+      fp.close();
+      fp.join();
+    }
+  return 0;
+}
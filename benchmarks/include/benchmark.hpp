@@ -0,0 +1,263 @@
+#ifndef TRISYCL_BENCHMARKS_BENCHMARK_HPP
+#define TRISYCL_BENCHMARKS_BENCHMARK_HPP
+
+/** \file A minimal harness for the performance benchmarks of the
+    triSYCL host runtime
+
+    Each benchmark program is a suite of measurements, displayed on
+    the standard output and written as a JSON file to be compared
+    from a release to another.
+
+    The program options are:
+
+    - \c --json \c file to choose the JSON file, by default the name
+      of the suite with a \c .json extension in the current directory;
+
+    - \c --scale \c x to multiply the number of operations of each
+      measurement, for example 0.1 for a quick run or 10 for a more
+      precise one.
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace benchmark {
+
+/// The clock used for the measurements
+using clock = std::chrono::steady_clock;
+
+
+/// The result of a measurement
+struct result {
+  /// What is measured
+  std::string name;
+
+  /// The parameters of the measurement, such as a range shape
+  std::string parameters;
+
+  /// The number of operations done by each repetition
+  std::size_t operations;
+
+  /// The time of an operation in nanoseconds for each repetition
+  std::vector<double> ns_per_op;
+
+  /// The number of bytes transferred by an operation, if meaningful
+  double bytes_per_op;
+
+
+  /// The fastest repetition
+  double min() const {
+    return *std::min_element(ns_per_op.begin(), ns_per_op.end());
+  }
+
+
+  /// The median repetition, more robust to the noise than the mean
+  double median() const {
+    auto v = ns_per_op;
+    std::nth_element(v.begin(), v.begin() + v.size()/2, v.end());
+    return v[v.size()/2];
+  }
+
+
+  /// The mean of the repetitions
+  double mean() const {
+    return std::accumulate(ns_per_op.begin(), ns_per_op.end(), 0.0)
+      /ns_per_op.size();
+  }
+
+
+  /// The bandwidth of the median repetition in bytes per second
+  double bytes_per_second() const {
+    return bytes_per_op*1e9/median();
+  }
+};
+
+
+/// A suite of measurements written as a JSON file
+class suite {
+  /// The name of the suite
+  std::string suite_name;
+
+  /// The JSON output file
+  std::string json_file;
+
+  /// The factor applied to the number of operations
+  double scale = 1;
+
+  /// The number of timed repetitions of each measurement
+  int repetitions = 5;
+
+  /// The results of the measurements
+  std::vector<result> results;
+
+
+  /// Write a string as a JSON string
+  static void write_string(std::ostream &o, std::string_view s) {
+    o << '"';
+    for (auto c : s) {
+      if (c == '"' || c == '\\')
+        o << '\\';
+      o << c;
+    }
+    o << '"';
+  }
+
+public:
+
+  /** Start a suite of measurements
+
+      \param[in] name is the name of the suite
+
+      \param[in] argc and argv are the program options
+  */
+  suite(std::string name, int argc, char *argv[])
+    : suite_name { std::move(name) }
+    , json_file { suite_name + ".json" } {
+    for (int i = 1; i < argc; ++i) {
+      std::string_view option = argv[i];
+      if (option == "--json" && i + 1 < argc)
+        json_file = argv[++i];
+      else if (option == "--scale" && i + 1 < argc)
+        scale = std::atof(argv[++i]);
+      else {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--json file] [--scale factor]" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+    std::cout << std::left << std::setw(32) << suite_name
+              << std::setw(36) << "parameters"
+              << std::right << std::setw(14) << "median ns/op"
+              << std::setw(14) << "min ns/op"
+              << std::setw(14) << "MB/s" << std::endl;
+  }
+
+
+  /// Scale a number of operations, keeping at least 1
+  std::size_t operations(std::size_t n) const {
+    return std::max<std::size_t>(1, n*scale);
+  }
+
+
+  /** Measure a batch of operations
+
+      The batch is run once to warm up, then repetitions times with
+      timing.
+
+      \param[in] name is what is measured
+
+      \param[in] parameters describes the parameters of the measurement
+
+      \param[in] operations is the number of operations done by a
+      batch, already scaled
+
+      \param[in] batch is the callable doing the operations
+
+      \param[in] bytes_per_op is the number of bytes transferred by an
+      operation, or 0 if a bandwidth is meaningless
+  */
+  template <typename Batch>
+  const result &measure(std::string name, std::string parameters,
+                        std::size_t operations, Batch &&batch,
+                        double bytes_per_op = 0) {
+    result r { std::move(name), std::move(parameters), operations, {},
+               bytes_per_op };
+    batch();
+    for (int i = 0; i < repetitions; ++i) {
+      auto start = clock::now();
+      batch();
+      std::chrono::duration<double, std::nano> d = clock::now() - start;
+      r.ns_per_op.push_back(d.count()/operations);
+    }
+    std::cout << std::left << std::setw(32) << r.name
+              << std::setw(36) << r.parameters << std::right
+              << std::fixed << std::setprecision(1)
+              << std::setw(14) << r.median() << std::setw(14) << r.min();
+    if (bytes_per_op)
+      std::cout << std::setw(14) << r.bytes_per_second()/1e6;
+    std::cout << std::endl;
+    results.push_back(std::move(r));
+    return results.back();
+  }
+
+
+  /// Measure a number of calls to an operation
+  template <typename Operation>
+  const result &measure_each(std::string name, std::string parameters,
+                             std::size_t operations, Operation &&op,
+                             double bytes_per_op = 0) {
+    return measure(std::move(name), std::move(parameters), operations,
+                   [&] {
+                     for (std::size_t i = 0; i < operations; ++i)
+                       op();
+                   }, bytes_per_op);
+  }
+
+
+  /// Write the results into the JSON file
+  ~suite() {
+    std::ofstream o { json_file };
+    o << "{\n  \"suite\": ";
+    write_string(o, suite_name);
+    o << ",\n  \"context\": {\n    \"compiler\": ";
+#ifdef __VERSION__
+    write_string(o, __VERSION__);
+#else
+    write_string(o, "unknown");
+#endif
+    o << ",\n    \"hardware_threads\": "
+      << std::thread::hardware_concurrency()
+      << ",\n    \"openmp\": "
+#ifdef _OPENMP
+      << "true"
+#else
+      << "false"
+#endif
+      << ",\n    \"scale\": " << scale
+      << ",\n    \"repetitions\": " << repetitions
+      << "\n  },\n  \"results\": [";
+    o << std::setprecision(3) << std::fixed;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      auto &r = results[i];
+      o << (i ? ",\n" : "\n") << "    { \"name\": ";
+      write_string(o, r.name);
+      o << ", \"parameters\": ";
+      write_string(o, r.parameters);
+      o << ", \"operations\": " << r.operations
+        << ", \"ns_per_op\": { \"min\": " << r.min()
+        << ", \"median\": " << r.median()
+        << ", \"mean\": " << r.mean() << " }";
+      if (r.bytes_per_op)
+        o << ", \"bytes_per_second\": " << r.bytes_per_second();
+      o << " }";
+    }
+    o << "\n  ]\n}\n";
+    std::cout << "Results written to " << json_file << std::endl;
+  }
+};
+
+}
+
+/*
+    # Some Emacs stuff:
+    ### Local Variables:
+    ### ispell-local-dictionary: "american"
+    ### eval: (flyspell-prog-mode)
+    ### End:
+*/
+
+#endif // TRISYCL_BENCHMARKS_BENCHMARK_HPP
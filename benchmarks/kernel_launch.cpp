@@ -0,0 +1,98 @@
+/* Measure the overhead of the kernel submission and execution on the
+   host device
+
+   RUN: %{execute}%s
+*/
+#include <sycl/sycl.hpp>
+
+#include <string>
+
+#include "include/benchmark.hpp"
+
+using namespace sycl;
+
+/// Describe a range shape like "64x32"
+template <int Dimensions>
+std::string shape(const range<Dimensions> &r) {
+  std::string s;
+  for (int i = 0; i < Dimensions; ++i)
+    s += (i ? "x" : "") + std::to_string(r[i]);
+  return s;
+}
+
+
+/// Measure a parallel_for on an empty kernel and on a trivial one
+template <int Dimensions>
+void measure_parallel_for(benchmark::suite &s, queue &q,
+                          const range<Dimensions> &r) {
+  auto n = s.operations(200);
+  s.measure_each("parallel_for empty", shape(r), n, [&] {
+    q.submit([&] (handler &cgh) {
+      cgh.parallel_for(r, [=] (item<Dimensions>) {});
+    });
+    q.wait();
+  });
+  buffer<int, Dimensions> b { r };
+  s.measure_each("parallel_for write", shape(r), n, [&] {
+    q.submit([&] (handler &cgh) {
+      auto a = b.template get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(r, [=] (item<Dimensions> i) {
+        a[i] = i.get_linear_id();
+      });
+    });
+    q.wait();
+  }, r.size()*sizeof(int));
+}
+
+
+
+/// Measure the same trivial kernel on a static_range<>
+template <std::size_t... Extents>
+void measure_static_parallel_for(benchmark::suite &s, queue &q) {
+  constexpr int dimensions = sizeof...(Extents);
+  static_range<Extents...> r;
+  buffer<int, dimensions> b { r.get_range() };
+  s.measure_each("parallel_for static write", shape(r.get_range()),
+                 s.operations(200), [&] {
+    q.submit([&] (handler &cgh) {
+      auto a = b.template get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(r, [=] (id<dimensions> i) { a[i] = i[dimensions - 1]; });
+    });
+    q.wait();
+  }, r.size()*sizeof(int));
+}
+
+int main(int argc, char *argv[]) {
+  benchmark::suite s { "kernel_launch", argc, argv };
+  queue q;
+
+  // The latency from the submission to the end of a kernel
+  auto n = s.operations(2000);
+  s.measure_each("submit+wait single_task", "", n, [&] {
+    q.submit([&] (handler &cgh) { cgh.single_task([] {}); });
+    q.wait();
+  });
+
+  // The cost of a submission only, the kernels being waited for at
+  // the end of the batch
+  s.measure("submit single_task", "batch", n, [&] {
+    for (std::size_t i = 0; i < n; ++i)
+      q.submit([&] (handler &cgh) { cgh.single_task([] {}); });
+    q.wait();
+  });
+
+  // The overhead of the iteration space per range shape
+  measure_parallel_for(s, q, range<1> { 1 });
+  measure_parallel_for(s, q, range<1> { 1024 });
+  measure_parallel_for(s, q, range<1> { 1 << 20 });
+  measure_parallel_for(s, q, range<2> { 1024, 1024 });
+  measure_parallel_for(s, q, range<2> { 1 << 20, 1 });
+  measure_parallel_for(s, q, range<2> { 1, 1 << 20 });
+  measure_parallel_for(s, q, range<3> { 128, 128, 64 });
+
+  // The same shapes known at compile time
+  measure_static_parallel_for<1 << 20>(s, q);
+  measure_static_parallel_for<1024, 1024>(s, q);
+  measure_static_parallel_for<128, 128, 64>(s, q);
+  return 0;
+}
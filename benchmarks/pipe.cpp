@@ -0,0 +1,45 @@
+/* Measure the throughput of the pipes between concurrent kernels on
+   the host device
+
+   RUN: %{execute}%s
+*/
+#include <sycl/sycl.hpp>
+
+#include <string>
+
+#include "include/benchmark.hpp"
+
+using namespace sycl;
+
+/// Measure the transfer of some values through a pipe of some capacity
+template <int Capacity>
+void measure_pipe(benchmark::suite &s, queue &q) {
+  using p = sycl::pipe<class bench_pipe, int, Capacity>;
+  auto n = s.operations(100'000);
+  s.measure("pipe", "capacity " + std::to_string(Capacity), n, [&] {
+    q.submit([&] (handler &cgh) {
+      cgh.single_task([=] {
+        for (std::size_t i = 0; i < n; ++i)
+          p::write(i);
+      });
+    });
+    q.submit([&] (handler &cgh) {
+      cgh.single_task([=] {
+        for (std::size_t i = 0; i < n; ++i)
+          p::read();
+      });
+    });
+    q.wait();
+  }, sizeof(int));
+}
+
+
+int main(int argc, char *argv[]) {
+  benchmark::suite s { "pipe", argc, argv };
+  queue q;
+  measure_pipe<1>(s, q);
+  measure_pipe<16>(s, q);
+  measure_pipe<256>(s, q);
+  measure_pipe<4096>(s, q);
+  return 0;
+}
@@ -567,6 +567,12 @@ template <typename DevTy> struct queue {
 template <typename DevTy> queue(DevTy&) -> queue<DevTy>;
 
 /// For now buffers are simple vector. this is temporary
+///
+/// On hardware the accessed range of a buffer is copied to the tile when the
+/// kernel starts and the written range is copied back at the end of
+/// queue::submit*. On emulation the accessors are bound to the host buffer
+/// memory and nothing is copied, so the buffers must not be read from the host
+/// before queue::submit* returns.
 template <typename T> using buffer = std::vector<T>;
 
 enum access_mode {
@@ -186,6 +186,23 @@ template <typename ImplTy> struct device_mem_handle_adaptor : ImplTy {
   template <typename T> void store(generic_ptr<T> ptr, T val) {
     ImplTy::memcpy_h2d(ptr, std::addressof(val), sizeof(T));
   }
+  /// Get a host pointer to read size bytes of device memory starting at ptr.
+  /// When the device memory is directly addressable from the host, like in
+  /// emulation, it is returned without any copy. Otherwise the data is copied
+  /// into the staging memory, which is returned.
+  ///
+  /// The service request is the synchronization point: the pointer may alias
+  /// the live device memory, so it must only be read in act_on_data and not
+  /// be kept once the request has been answered.
+  template <typename T> T* map_d2h(generic_ptr<T> ptr, uint32_t size,
+                                   void* staging) {
+    if constexpr (requires(ImplTy& i) { i.get_host_addr(ptr); })
+      return static_cast<T*>(ImplTy::get_host_addr(ptr));
+    else {
+      ImplTy::memcpy_d2h(staging, ptr, size);
+      return static_cast<T*>(staging);
+    }
+  }
 };
 
 /// device_accessor_impl is the internal storage of an accessors on the device.
@@ -14,6 +14,9 @@
 #include "program_manager.hpp"
 #include "sync.hpp"
 #include "xaie_wrapper.hpp"
+#if !defined(__SYCL_DEVICE_ONLY__)
+#include "xaie_batch.hpp"
+#endif
 
 namespace aie::detail {
 
@@ -79,11 +82,18 @@ struct host_tile_impl : host_tile_impl_fallback {
     dev_handle.core_reset();
   }
   ~host_tile_impl() {
-    for (auto& elem : write_backs) {
-      elem();
-    }
+    /// Read back all the buffers of the tile together.
+    xaie::transfer_batch<xaie::handle> batch { dev_handle };
+    for (auto& wb : write_backs)
+      batch.memcpy_d2h(wb.host_addr, wb.dev_addr, wb.size);
   }
-  std::vector<std::function<void()>> write_backs;
+  /// A buffer range to copy back from the device to the host.
+  struct write_back {
+    void* host_addr;
+    uint32_t dev_addr;
+    uint32_t size;
+  };
+  std::vector<write_back> write_backs;
   /// Write the lambda on the device such that the kernel can use it.
   template <typename KernelDesc, typename KernelLambda>
   void write_lambda(KernelLambda& L, uint32_t dev_lambda_addr,
@@ -91,8 +101,11 @@ struct host_tile_impl : host_tile_impl_fallback {
     TRISYCL_DUMP2("Lambda address = " << (void*)(std::uintptr_t)dev_lambda_addr,
                   "memory");
 
+    /// Gather all the writes to the tile memory to submit them together.
+    xaie::transfer_batch<xaie::handle> batch { dev_handle };
+
     /// Write the lambda to memory, the accessors will get corrected later.
-    dev_handle.store<KernelLambda, /*no_check*/ true>(dev_lambda_addr, L);
+    batch.store<KernelLambda, /*no_check*/ true>(dev_lambda_addr, L);
 
     /// iterate over the members of the lambda
     for (int i = 0; i < KernelDesc::getNumParams(); i++) {
@@ -117,7 +130,7 @@ struct host_tile_impl : host_tile_impl_fallback {
           heap::malloc(dev_handle, heap_start, size_in_bytes);
 
       /// transfer the buffer to the device
-      dev_handle.memcpy_h2d(dev_data_addr, acc_addr->impl->data, size_in_bytes);
+      batch.memcpy_h2d(dev_data_addr, acc_addr->impl->data, size_in_bytes);
 
       /// build the pointer representation from the device's perspective
       dev_acc.data =
@@ -125,24 +138,22 @@ struct host_tile_impl : host_tile_impl_fallback {
 
       /// Overwrite the host representation of an accessor written the device
       /// with the proper device representation we just built.
-      dev_handle.store<device_accessor_impl, /*no_check*/ true>(
+      batch.store<device_accessor_impl, /*no_check*/ true>(
           dev_lambda_addr + kdesc.offset, dev_acc);
 
       /// Setup the write back for the buffer.
-      write_backs.push_back([=, dev_handle = dev_handle,
-                             host_addr = host_out_of_line.data]() mutable {
-        dev_handle.memcpy_d2h(
-            host_addr +
-                host_out_of_line.write_back_start * host_out_of_line.elem_size,
-            dev_data_addr +
-                host_out_of_line.write_back_start * host_out_of_line.elem_size,
-            host_out_of_line.write_back_size * host_out_of_line.elem_size);
-      });
+      unsigned write_back_start =
+          host_out_of_line.write_back_start * host_out_of_line.elem_size;
+      write_backs.push_back(
+          { host_out_of_line.data + write_back_start,
+            dev_data_addr + write_back_start,
+            static_cast<uint32_t>(host_out_of_line.write_back_size *
+                                  host_out_of_line.elem_size) });
     }
     if (mem_ptr) {
       /// If the memory tile was accessed send it to the device.
-      dev_handle.memcpy_h2d(offset_table::get_tile_mem_begin_offset(),
-                            mem_ptr, mem_size);
+      batch.memcpy_h2d(offset_table::get_tile_mem_begin_offset(), mem_ptr,
+                       mem_size);
     }
   }
   host_lock_impl lock(int i) {
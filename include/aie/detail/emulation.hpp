@@ -92,6 +92,9 @@ struct device_mem_handle_impl {
   void memcpy_d2h(void* dst, generic_ptr<void> src, uint32_t size) {
     std::memcpy(dst, src.ptr, size);
   }
+  /// The device memory is host memory in emulation, so it can be used in place
+  /// while the requesting tile is stopped in its service request
+  void* get_host_addr(generic_ptr<void> ptr) { return ptr.ptr; }
 };
 
 using device_mem_handle = device_mem_handle_adaptor<device_mem_handle_impl>;
@@ -109,6 +112,11 @@ struct device_impl {
   int size_x;
   int size_y;
   std::atomic<void*> services = nullptr;
+  /// All the tiles run as fibers on a single thread. A service is executed
+  /// inline by the fiber of the requesting tile, so no other tile can run
+  /// while a service reads the tile memory in place with
+  /// device_mem_handle::map_d2h(). Using more threads would require copying
+  /// the data instead.
   fiber_pool pool{1, fiber_pool::sched::round_robin, false};
   boost::fibers::mutex mutex;
   boost::fibers::condition_variable cv;
@@ -170,12 +178,16 @@ struct host_tile_impl {
   }
 
   template <typename AccTy> void register_accessor(const AccTy&) {
-    /// This is only needed if we start supporting async execution like
-    /// SYCL.
+    /// The accessors point directly to the memory of the host buffers, so
+    /// there is nothing to copy in or out of the tiles. The host only sees a
+    /// consistent state after the queue::submit* synchronization point which
+    /// waits for all the tiles. This would need some tracking if we start
+    /// supporting async execution like SYCL.
   }
 
   void notify_has_accessed_mem(void* mem, std::size_t size) {
-    /// This is only needed on hardware.
+    /// The memory tiles are used in place by the device tiles, so this is only
+    /// needed on hardware.
   }
 
   host_lock_impl lock(int i) { return lock(aie::dir::self, i); }
@@ -0,0 +1,299 @@
+#ifndef AIE_DETAIL_XAIE_BATCH_HPP
+#define AIE_DETAIL_XAIE_BATCH_HPP
+
+/// This provides batching of the host-device memory transfers done through an
+/// xaie::handle.
+///
+/// Instead of issuing one libxaiengine call per load, store or memcpy, the
+/// reads and writes are queued into a transfer_batch, possibly across tiles,
+/// the adjacent or overlapping ranges are coalesced and all the transfers are
+/// submitted together, the writes inside a single libxaiengine transaction.
+///
+/// This does not depend on libxaiengine: the batch is parameterized by the
+/// handle type so it can also be used with xaie::host_memory, a stand-in of the
+/// device memory in host memory counting the transfers, to test and benchmark
+/// the batching without hardware.
+
+#include "hardware.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aie::detail::xaie {
+
+/// Count the transfers done by a transfer_batch or a host_memory.
+struct transfer_stats {
+  /// Number of reads and writes requested.
+  std::size_t requests = 0;
+  /// Number of memory transfers actually done.
+  std::size_t transfers = 0;
+  /// Number of bytes actually transferred.
+  std::size_t bytes = 0;
+};
+
+/// Queue reads and writes to the memory of the tiles reachable from a handle
+/// and submit them together.
+///
+/// The writes are applied in order: a write overlapping a previous one in the
+/// same batch overrides it. All the writes are done before the reads at
+/// submission, so a read sees the writes of its batch. The data to write is
+/// copied when queued but the destination of a read is only written on
+/// submission, so it has to stay alive until then.
+template <typename Handle> class transfer_batch {
+  /// Tiles are identified by their coordinates.
+  using tile_id = std::pair<int, int>;
+
+  /// Disjoint and non-adjacent ranges of data to write in a tile, indexed by
+  /// their start offset.
+  using segments = std::map<std::uint32_t, std::vector<std::byte>>;
+
+  struct read_request {
+    tile_id tile;
+    std::uint32_t offset;
+    std::uint32_t size;
+    void* dst;
+  };
+
+  Handle h;
+  std::map<tile_id, segments> writes;
+  std::vector<read_request> reads;
+  transfer_stats stats;
+
+  static tile_id get_id(position p) { return { p.x, p.y }; }
+
+  /// Insert a write into the segments of a tile, merging it with the
+  /// overlapping or adjacent segments.
+  static void add_segment(segments& segs, std::uint32_t offset,
+                          const std::byte* src, std::uint32_t size) {
+    std::uint32_t begin = offset;
+    std::uint32_t end = offset + size;
+    /// Find the first segment which may touch the new range.
+    auto first = segs.upper_bound(begin);
+    if (first != segs.begin()) {
+      auto prev = std::prev(first);
+      if (prev->first + prev->second.size() >= begin)
+        first = prev;
+    }
+    auto last = first;
+    while (last != segs.end() && last->first <= end) {
+      begin = std::min(begin, last->first);
+      end = std::max<std::uint32_t>(end, last->first + last->second.size());
+      ++last;
+    }
+    if (first == last) {
+      segs.emplace(begin, std::vector<std::byte>(src, src + size));
+      return;
+    }
+    /// Make the merged segment start with the new range if needed.
+    if (first->first > begin)
+      first = segs.emplace_hint(first, begin, std::vector<std::byte> {});
+    /// Grow the first segment in place, which makes appending cheap.
+    auto& merged = first->second;
+    merged.resize(end - begin);
+    /// The old data first, so the new data overrides it.
+    for (auto it = std::next(first); it != last; ++it)
+      std::ranges::copy(it->second, merged.begin() + (it->first - begin));
+    std::memcpy(merged.data() + (offset - begin), src, size);
+    segs.erase(std::next(first), last);
+  }
+
+  void submit_writes() {
+    for (auto& [tile, segs] : writes)
+      for (auto& [offset, data] : segs) {
+        h.on(position { tile.first, tile.second })
+            .memcpy_h2d(offset, data.data(), data.size());
+        stats.transfers++;
+        stats.bytes += data.size();
+      }
+    writes.clear();
+  }
+
+  void submit_reads() {
+    std::ranges::sort(reads, [](const read_request& a, const read_request& b) {
+      return std::tie(a.tile, a.offset) < std::tie(b.tile, b.offset);
+    });
+    std::vector<std::byte> buffer;
+    for (auto first = reads.begin(); first != reads.end();) {
+      /// Gather the following reads overlapping or adjacent to this one.
+      std::uint32_t begin = first->offset;
+      std::uint32_t end = begin + first->size;
+      auto last = std::next(first);
+      while (last != reads.end() && last->tile == first->tile &&
+             last->offset <= end) {
+        end = std::max(end, last->offset + last->size);
+        ++last;
+      }
+      auto tile = h.on(position { first->tile.first, first->tile.second });
+      if (std::next(first) == last)
+        tile.memcpy_d2h(first->dst, begin, end - begin);
+      else {
+        buffer.resize(end - begin);
+        tile.memcpy_d2h(buffer.data(), begin, end - begin);
+        for (auto it = first; it != last; ++it)
+          std::memcpy(it->dst, buffer.data() + (it->offset - begin), it->size);
+      }
+      stats.transfers++;
+      stats.bytes += end - begin;
+      first = last;
+    }
+    reads.clear();
+  }
+
+public:
+  /// Create a batch of transfers going through a handle.
+  transfer_batch(Handle handle) : h { handle } {}
+
+  transfer_batch(const transfer_batch&) = delete;
+  transfer_batch& operator=(const transfer_batch&) = delete;
+
+  /// Submit the pending transfers on destruction.
+  ~transfer_batch() { submit(); }
+
+  /// Queue a copy from host to the memory of the tile at position p.
+  void memcpy_h2d(position p, std::uint32_t dst, const void* src,
+                  std::uint32_t size) {
+    assert(dst + size <= tile_size && "write out of the tile memory");
+    stats.requests++;
+    if (size)
+      add_segment(writes[get_id(p)], dst,
+                  static_cast<const std::byte*>(src), size);
+  }
+
+  /// Queue a copy from host to the memory of the tile of the handle.
+  void memcpy_h2d(std::uint32_t dst, const void* src, std::uint32_t size) {
+    memcpy_h2d(h.get_aie_pos(), dst, src, size);
+  }
+
+  /// Queue a copy from the memory of the tile at position p to host.
+  void memcpy_d2h(position p, void* dst, std::uint32_t src,
+                  std::uint32_t size) {
+    assert(src + size <= tile_size && "read out of the tile memory");
+    stats.requests++;
+    if (size)
+      reads.push_back({ get_id(p), src, size, dst });
+  }
+
+  /// Queue a copy from the memory of the tile of the handle to host.
+  void memcpy_d2h(void* dst, std::uint32_t src, std::uint32_t size) {
+    memcpy_d2h(h.get_aie_pos(), dst, src, size);
+  }
+
+  /// Queue the store of an object in the memory of the tile of the handle.
+  template <typename T, bool no_check = false>
+  void store(std::uint32_t offset, const T& val) {
+    static_assert(no_check || std::is_trivially_copyable<T>::value,
+                  "This object cannot be transferred");
+    memcpy_h2d(offset, std::addressof(val), sizeof(T));
+  }
+
+  /// Queue the store of an object at a device pointer.
+  template <typename T, typename U> void store(dev_ptr<U> ptr, const T& val) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "This object cannot be transferred");
+    memcpy_h2d(h.get_aie_pos().on(ptr.get_dir()), ptr.get_offset(),
+               std::addressof(val), sizeof(T));
+  }
+
+  /// Queue the load of an object from the memory of the tile of the handle.
+  /// The object is only written by submit().
+  template <typename T> void load(std::uint32_t offset, T& val) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "This object cannot be transferred");
+    memcpy_d2h(std::addressof(val), offset, sizeof(T));
+  }
+
+  /// Do all the pending transfers.
+  void submit() {
+    if (!writes.empty()) {
+      if constexpr (requires { h.get_transaction(); }) {
+        /// Gather the writes in a single libxaiengine transaction.
+        auto transaction = h.get_transaction();
+        submit_writes();
+      } else
+        submit_writes();
+    }
+    if (!reads.empty())
+      submit_reads();
+  }
+
+  /// Get the statistics about the transfers of this batch.
+  const transfer_stats& get_stats() const { return stats; }
+};
+
+/// A stand-in of the device memory in host memory.
+///
+/// Each tile has a memory of tile_size bytes, allocated on first use and
+/// initialized to 0. The handles provide the memory interface of
+/// xaie::handle and all the transfers are counted.
+class host_memory {
+  std::map<std::pair<int, int>, std::unique_ptr<std::byte[]>> tiles;
+  transfer_stats stats;
+
+  std::byte* get_tile(position p) {
+    auto& mem = tiles[{ p.x, p.y }];
+    if (!mem)
+      mem = std::make_unique<std::byte[]>(tile_size);
+    return mem.get();
+  }
+
+public:
+  /// A handle to the memory of a tile.
+  struct handle {
+    host_memory* mem = nullptr;
+    position pos = { 0, 0 };
+
+    handle on(position p) { return { mem, p }; }
+    handle on(dir d) { return { mem, pos.on(d) }; }
+    handle on(int x, int y) { return on({ x, y }); }
+    position get_aie_pos() { return pos; }
+    dir get_self_dir() { return ::aie::get_self_dir(pos.get_parity()); }
+
+    /// memcpy from device to host
+    void memcpy_d2h(void* dst, std::uint32_t src, std::uint32_t size) {
+      assert(src + size <= tile_size && "read out of the tile memory");
+      std::memcpy(dst, mem->get_tile(pos) + src, size);
+      mem->stats.transfers++;
+      mem->stats.bytes += size;
+    }
+
+    /// memcpy from host to device
+    void memcpy_h2d(std::uint32_t dst, const void* src, std::uint32_t size) {
+      assert(dst + size <= tile_size && "write out of the tile memory");
+      std::memcpy(mem->get_tile(pos) + dst, src, size);
+      mem->stats.transfers++;
+      mem->stats.bytes += size;
+    }
+
+    template <typename T> T load(std::uint32_t offset) {
+      static_assert(std::is_trivially_copyable<T>::value,
+                    "This object cannot be transferred");
+      T ret;
+      memcpy_d2h(std::addressof(ret), offset, sizeof(T));
+      return ret;
+    }
+
+    template <typename T> void store(std::uint32_t offset, const T& val) {
+      static_assert(std::is_trivially_copyable<T>::value,
+                    "This object cannot be transferred");
+      memcpy_h2d(offset, std::addressof(val), sizeof(T));
+    }
+  };
+
+  handle get_handle(position p) { return { this, p }; }
+
+  /// Get the statistics about all the transfers done so far.
+  const transfer_stats& get_stats() const { return stats; }
+};
+
+} // namespace aie::detail::xaie
+
+#endif
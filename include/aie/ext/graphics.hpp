@@ -761,18 +761,24 @@ struct graphic_application {
       assert(dev_data.max_value != dev_data.min_value &&
              "host received incoherent data");
 
-      h.memcpy_d2h(graphic_buffer.data(), dev_data.data, graphic_buffer.size());
+      /// Only copied on hardware, the tile memory is used in place otherwise.
+      /// The requesting tile waits for this function to return, so the pixels
+      /// are stable until then.
+      PixelTy* pixels = h.map_d2h(dev_data.data, graphic_buffer.size(),
+                                  graphic_buffer.data());
 
       // auto* ptr = reinterpret_cast<PixelTy*>(graphic_buffer.data());
       // for (int i = 0; i < graphic_buffer.size() / sizeof(PixelTy); i++)
       //   std::cout << " " << ptr[i];
       // std::cout << std::endl;
 
-      /// This call is not synchronized but this should only be executed while
-      /// the main thread is waiting for the kernel to finish.
-      app.update_tile_data_image(
-          x, y, reinterpret_cast<PixelTy*>(graphic_buffer.data()),
-          dev_data.min_value, dev_data.max_value);
+      /// The pixels are converted into a new image before returning, which is
+      /// the only copy of the frame, so nothing reads the tile memory after
+      /// the tile resumes. This call is not synchronized with other threads
+      /// but this should only be executed while the main thread is waiting
+      /// for the kernel to finish.
+      app.update_tile_data_image(x, y, pixels, dev_data.min_value,
+                                 dev_data.max_value);
 
       if (x == 0 && y == 0) {
         auto current = std::chrono::system_clock::now();
@@ -25,7 +25,7 @@
 
 namespace trisycl {
 
-template <typename T, int Dimensions, typename Allocator>
+template <typename T, int Dimensions, typename Allocator, typename Layout>
 class buffer;
 
 namespace sycl_2_2 {
@@ -44,17 +44,21 @@ class handler;
 /** The accessor abstracts the way buffer or pipe data are accessed
     inside a kernel in a multidimensional variable length array way.
 
+    \tparam Layout is a triSYCL extension giving the mdspan layout of
+    the accessed buffer
+
     \todo Implement it for images according so section 3.3.4.5
 */
 template <typename DataType, int Dimensions,
           access::mode AccessMode =
               (std::is_const_v<DataType> ? access::mode::read
                                          : access::mode::read_write),
-          access::target Target = access::target::global_buffer>
+          access::target Target = access::target::global_buffer,
+          typename Layout = std::layout_right>
 class accessor
     : public detail::shared_ptr_implementation<
-          accessor<DataType, Dimensions, AccessMode, Target>,
-          detail::accessor<DataType, Dimensions, AccessMode, Target>>
+          accessor<DataType, Dimensions, AccessMode, Target, Layout>,
+          detail::accessor<DataType, Dimensions, AccessMode, Target, Layout>>
     , public detail::container_element_aspect<DataType> {
 
  public:
@@ -67,7 +71,8 @@ class accessor
   using accessor_detail = typename detail::accessor<DataType,
                                                     Dimensions,
                                                     AccessMode,
-                                                    Target>;
+                                                    Target,
+                                                    Layout>;
 
   // The type encapsulating the implementation
   using implementation_t = typename accessor::shared_ptr_implementation;
@@ -101,9 +106,9 @@ class accessor
       instead
   */
   template <typename Allocator>
-  accessor(buffer<DataType, Dimensions, Allocator> &target_buffer,
+  accessor(buffer<DataType, Dimensions, Allocator, Layout> &target_buffer,
            handler &command_group_handler) : implementation_t {
-    new detail::accessor<DataType, Dimensions, AccessMode, Target> {
+    new accessor_detail {
       target_buffer.implementation->implementation, command_group_handler }
   } {
     static_assert(Target == access::target::global_buffer
@@ -122,9 +127,9 @@ class accessor
       access_target defines the form of access being obtained.
   */
   template <typename Allocator>
-  accessor(buffer<DataType, Dimensions, Allocator> &target_buffer)
+  accessor(buffer<DataType, Dimensions, Allocator, Layout> &target_buffer)
     : implementation_t {
-    new detail::accessor<DataType, Dimensions, AccessMode, Target> {
+    new accessor_detail {
       target_buffer.implementation->implementation }
   } {
     static_assert(Target == access::target::host_buffer,
@@ -150,7 +155,7 @@ class accessor
       should be retained.
   */
   template <typename Allocator>
-  accessor(buffer<DataType, Dimensions, Allocator> &target_buffer,
+  accessor(buffer<DataType, Dimensions, Allocator, Layout> &target_buffer,
            handler &command_group_handler,
            const range<Dimensions> &offset,
            const range<Dimensions> &range) {
@@ -171,7 +176,8 @@ class accessor
     : implementation_t { new detail::accessor<DataType,
                                               Dimensions,
                                               AccessMode,
-                                              access::target::local> {
+                                              access::target::local,
+                                              Layout> {
       allocation_size, command_group_handler
         }
   }
@@ -492,24 +498,30 @@ public:
 
     \param[in] AccessMode precises whether the access is done in read
     or write mode. By default this is read+write
+
+    \param[in] Layout is the mdspan layout of the buffer, a triSYCL
+    extension
 */
 template <typename DataType,
           int Dimensions,
-          access::mode AccessMode = access::mode::read_write>
+          access::mode AccessMode = access::mode::read_write,
+          typename Layout = std::layout_right>
 class host_accessor : public accessor<DataType,
                                       Dimensions,
                                       AccessMode,
-                                      access::target::host_buffer> {
+                                      access::target::host_buffer,
+                                      Layout> {
   using base = accessor<DataType,
                         Dimensions,
                         AccessMode,
-                        access::target::host_buffer>;
+                        access::target::host_buffer,
+                        Layout>;
  public:
   using typename base::accessor;
 
   /// Create an accessor to a buffer to access from the host
   template <typename Allocator>
-  host_accessor(buffer<DataType, Dimensions, Allocator>& target_buffer)
+  host_accessor(buffer<DataType, Dimensions, Allocator, Layout>& target_buffer)
     : base { target_buffer } {}
 };
 
@@ -25,7 +25,8 @@ class handler;
 namespace detail {
 
 // Forward declaration of detail::accessor to declare the specialization
-template <typename T, int Dimensions, access::mode Mode, access::target Target>
+template <typename T, int Dimensions, access::mode Mode, access::target Target,
+          typename Layout>
 class accessor;
 
 /** \addtogroup data Data access and storage in SYCL
@@ -22,8 +22,15 @@ namespace trisycl::mixin {
     @{
 */
 
-/// SYCL accessor mixin providing multi-dimensional access features
-template <typename T, int Dimensions> class accessor {
+/** SYCL accessor mixin providing multi-dimensional access features
+
+    \tparam Layout is the mdspan layout policy mapping the indices to
+    the memory, such as std::layout_right for the usual C/C++
+    row-major order, std::layout_left for the column-major order of
+    Fortran or std::layout_stride for arbitrary strides
+*/
+template <typename T, int Dimensions, typename Layout = std::layout_right>
+class accessor {
 
  public:
   /** Extension to SYCL: provide pieces of STL container interface
@@ -42,10 +49,14 @@ template <typename T, int Dimensions> class accessor {
   */
   static auto constexpr rank() { return Dimensions; }
 
+  /// The mdspan layout policy of the data
+  using layout_type = Layout;
+
  protected:
   /// The memory lay-out of a buffer is a dynamic multidimensional array
   using mdspan =
-      std::mdspan<element_type, std::dextents<std::size_t, Dimensions>>;
+      std::mdspan<element_type, std::dextents<std::size_t, Dimensions>,
+                  Layout>;
 
   /** This is the multi-dimensional interface to the data that may point
       to either allocation in the case of storage managed by SYCL itself
@@ -77,6 +88,9 @@ template <typename T, int Dimensions> class accessor {
   /// Reference type to the elements
   using reference = typename mdspan::reference;
 
+  /// The mapping from the indices to the memory offsets
+  using mapping_type = typename mdspan::mapping_type;
+
   /// Used by the local accessor hack on top of host accessor
   accessor() = default;
 
@@ -84,6 +98,10 @@ template <typename T, int Dimensions> class accessor {
   accessor(pointer data, const range<rank()>& r)
       : access { data, extents_cast(r) } {}
 
+  /// Create an accessor with an explicit layout mapping on top of data
+  accessor(pointer data, const mapping_type& m)
+      : access { data, m } {}
+
   /// Create an accessor from another mdspan
   accessor(const mdspan& m)
       : access { m } {}
@@ -132,6 +150,20 @@ template <typename T, int Dimensions> class accessor {
   /// Get the underlying storage
   auto data() { return access.data_handle(); }
 
+  /** Return the dimension with the smallest stride in memory
+
+      Iterating on this dimension in the innermost loop gives
+      unit-stride accesses, which is the last dimension with
+      std::layout_right and the first one with std::layout_left
+  */
+  std::size_t contiguous_dimension() const {
+    std::size_t contiguous = Dimensions - 1;
+    for (std::size_t d = 0; d < Dimensions; ++d)
+      if (access.stride(d) < access.stride(contiguous))
+        contiguous = d;
+    return contiguous;
+  }
+
   /** Access to an mdspan element with indices implementing a tuple
       interface
 
@@ -16,6 +16,8 @@
     License. See LICENSE.TXT for details.
 */
 
+#include "triSYCL/detail/unimplemented.hpp"
+
 namespace trisycl {
 
 /** \addtogroup address_spaces Dealing with OpenCL address spaces
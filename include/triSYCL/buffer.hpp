@@ -59,14 +59,18 @@ template <typename T,
           int Dimensions = 1,
           /* Even a buffer of const T may need to allocate memory, so
              need an allocator of non const T */
-          typename Allocator = buffer_allocator<std::remove_const_t<T>>>
+          typename Allocator = buffer_allocator<std::remove_const_t<T>>,
+          /* triSYCL extension: the mdspan layout of the data in
+             memory, for example std::layout_left for column-major
+             data */
+          typename Layout = std::layout_right>
 class buffer
   /* Use the underlying buffer waiter implementation that can be
      shared in the SYCL model */
   : public detail::shared_ptr_implementation<
-                         buffer<T, Dimensions, Allocator>,
-                         detail::buffer_waiter<T, Dimensions, Allocator>>,
-    detail::debug<buffer<T, Dimensions, Allocator>> {
+                     buffer<T, Dimensions, Allocator, Layout>,
+                     detail::buffer_waiter<T, Dimensions, Allocator, Layout>>,
+    detail::debug<buffer<T, Dimensions, Allocator, Layout>> {
 public:
 
   /// The STL-like types
@@ -75,6 +79,13 @@ public:
   using const_reference = const value_type&;
   using allocator_type = Allocator;
 
+  /// The mdspan layout policy of the data in memory
+  using layout_type = Layout;
+
+  /// The mdspan describing some host memory usable by the buffer
+  using host_mdspan_type =
+    std::mdspan<T, std::dextents<std::size_t, Dimensions>, Layout>;
+
   /** Get the number of dimensions of the buffer
 
       Name inspired from ISO C++ P0009 mdspan papers
@@ -119,7 +130,7 @@ public:
   */
   buffer(const range<Dimensions> &r, Allocator allocator = {})
     : implementation_t { detail::waiter<T, Dimensions, Allocator>(
-                         new detail::buffer<T, Dimensions> { r }) }
+                         new detail::buffer<T, Dimensions, Layout> { r }) }
       {}
 
 
@@ -153,7 +164,8 @@ public:
   buffer(const T *host_data,
          const range<Dimensions> &r,
          Allocator allocator = {})
-    : implementation_t { detail::waiter(new detail::buffer<T, Dimensions>
+    : implementation_t { detail::waiter(
+                         new detail::buffer<T, Dimensions, Layout>
                          { host_data, r }) }
   {}
 
@@ -177,11 +189,38 @@ public:
   buffer(T *host_data,
          const range<Dimensions> &r,
          Allocator allocator = {})
-    : implementation_t { detail::waiter(new detail::buffer<T, Dimensions>
+    : implementation_t { detail::waiter(
+                         new detail::buffer<T, Dimensions, Layout>
                          { host_data, r }) }
   {}
 
 
+  /** Create a new buffer on top of some host memory described by an
+      mdspan
+
+      This is a triSYCL extension to work in place for example on
+      column-major data coming from Fortran or a BLAS library with a
+      std::layout_left mdspan, or on a strided view of some data with
+      a std::layout_stride mdspan. The indexing of the accessors is
+      unchanged, only the memory mapping follows the layout.
+
+      \param[inout] host_data is the mdspan with the storage and values
+      used by the buffer
+
+      \param[in] allocator is to be used by the SYCL runtime, of type
+      trisycl::buffer_allocator<T> by default
+
+      The data is copied back to the host memory as with the
+      constructor from a pointer and a range.
+  */
+  buffer(const host_mdspan_type& host_data, Allocator allocator = {})
+    : implementation_t { detail::waiter(
+                         new detail::buffer<T, Dimensions, Layout>
+                         { host_data.data_handle(),
+                           host_data.mapping() }) }
+  {}
+
+
   /** Create a new buffer with associated host memory from a range
 
       \param[inout] host_data points to the storage and values used by
@@ -259,7 +298,8 @@ public:
   buffer(shared_ptr_class<T> host_data,
          const range<Dimensions> &buffer_range,
          Allocator allocator = {})
-    : implementation_t { detail::waiter(new detail::buffer<T, Dimensions>
+    : implementation_t { detail::waiter(
+                         new detail::buffer<T, Dimensions, Layout>
                          { host_data, buffer_range }) }
   {}
 
@@ -304,8 +344,9 @@ public:
   buffer(InputIterator start_iterator,
          InputIterator end_iterator,
          Allocator allocator = {}) :
-    implementation_t { detail::waiter(new detail::buffer<T, Dimensions>
-                       { start_iterator, end_iterator }) }
+    implementation_t { detail::waiter(
+                         new detail::buffer<T, Dimensions, Layout>
+                         { start_iterator, end_iterator }) }
   {}
 
 
@@ -375,7 +416,7 @@ public:
   */
   template <access::mode Mode,
             access::target Target = access::target::global_buffer>
-  accessor<T, Dimensions, Mode, Target>
+  accessor<T, Dimensions, Mode, Target, Layout>
   get_access(handler &command_group_handler) {
     static_assert(Target == access::target::global_buffer
                   || Target == access::target::constant_buffer,
@@ -404,7 +445,7 @@ public:
       \todo More elegant solution
   */
   template <access::mode Mode>
-  accessor<T, Dimensions, Mode, access::target::host_buffer>
+  accessor<T, Dimensions, Mode, access::target::host_buffer, Layout>
   get_access() {
     implementation->implementation->template track_access_mode<Mode, access::target::host_buffer>();
     return { *this };
@@ -561,6 +602,17 @@ buffer(FIB begin, FIE end)
   buffer(auto /* std::continuous_range */& host_data)
     -> buffer<std::ranges::range_value_t<decltype(host_data)>, 1>;
 
+/** A deduction guide to infer the buffer type with its layout from an
+    mdspan on some host memory
+
+    \todo Add this to SYCL Next
+*/
+template <typename T, typename Extents, typename Layout,
+          typename AccessorPolicy>
+buffer(const std::mdspan<T, Extents, Layout, AccessorPolicy>& host_data)
+    -> buffer<T, Extents::rank(), buffer_allocator<std::remove_const_t<T>>,
+              Layout>;
+
 
 /// @} End the data Doxygen group
 
@@ -575,10 +627,12 @@ namespace std {
 
 template <typename T,
           int Dimensions,
-          typename Allocator>
-struct hash<trisycl::buffer<T, Dimensions, Allocator>> {
+          typename Allocator,
+          typename Layout>
+struct hash<trisycl::buffer<T, Dimensions, Allocator, Layout>> {
 
-  auto operator()(const trisycl::buffer<T, Dimensions, Allocator> &b) const {
+  auto operator()(const trisycl::buffer<T, Dimensions, Allocator, Layout> &b)
+    const {
     // Forward the hashing to the implementation
     return b.hash();
   }
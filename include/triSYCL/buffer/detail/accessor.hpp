@@ -30,8 +30,12 @@ class handler;
 
 namespace detail {
 
-// Forward declaration of detail::buffer for use in accessor
-template <typename T, int Dimensions> class buffer;
+/** Forward declaration of detail::buffer for use in accessor
+
+    The default layout is the row-major one of C and C++
+*/
+template <typename T, int Dimensions, typename Layout = std::layout_right>
+class buffer;
 
 /** \addtogroup data Data access and storage in SYCL
     @{
@@ -48,25 +52,29 @@ template <typename T, int Dimensions> class buffer;
     make it const (since in examples we have lambda with [=] without
     mutable lambda).
 
+    \tparam Layout is the mdspan layout policy of the accessed buffer
+
     \todo Use the access::mode
 */
 template <typename T, int Dimensions, access::mode Mode,
-          access::target Target /* = access::global_buffer */>
+          access::target Target /* = access::global_buffer */,
+          typename Layout = std::layout_right>
 class accessor
     : public detail::accessor_base
-    , public facade::accessor<mixin::accessor<T, Dimensions>>
-    , public std::enable_shared_from_this<accessor<T, Dimensions, Mode, Target>>
-    , public detail::debug<accessor<T, Dimensions, Mode, Target>> {
+    , public facade::accessor<mixin::accessor<T, Dimensions, Layout>>
+    , public std::enable_shared_from_this<
+          accessor<T, Dimensions, Mode, Target, Layout>>
+    , public detail::debug<accessor<T, Dimensions, Mode, Target, Layout>> {
   /** Keep a reference to the accessed buffer
 
       Beware that it owns the buffer, which means that the accessor
       has to be destroyed to release the buffer and potentially
       unblock a kernel at the end of its execution
   */
-  std::shared_ptr<detail::buffer<T, Dimensions>> buf;
+  std::shared_ptr<detail::buffer<T, Dimensions, Layout>> buf;
 
   /// Where most of the user-facing interface dwells
-  using facade = facade::accessor<mixin::accessor<T, Dimensions>>;
+  using facade = facade::accessor<mixin::accessor<T, Dimensions, Layout>>;
 
  public:
 #ifdef TODO
@@ -88,7 +96,8 @@ class accessor
       \todo fix the specification to rename target that shadows
       template parm
   */
-  accessor(std::shared_ptr<detail::buffer<T, Dimensions>> target_buffer)
+  accessor(
+      std::shared_ptr<detail::buffer<T, Dimensions, Layout>> target_buffer)
       : facade { target_buffer->access }
       , buf { target_buffer } {
     target_buffer->template track_access_mode<Mode>();
@@ -115,8 +124,9 @@ class accessor
       \todo fix the specification to rename target that shadows
       template parm
   */
-  accessor(std::shared_ptr<detail::buffer<T, Dimensions>> target_buffer,
-           handler& command_group_handler)
+  accessor(
+      std::shared_ptr<detail::buffer<T, Dimensions, Layout>> target_buffer,
+      handler& command_group_handler)
       : facade { target_buffer->access }
       , buf { target_buffer } {
     target_buffer->template track_access_mode<Mode>();
@@ -127,6 +137,10 @@ class accessor
                   "when a handler is used");
     // Register the buffer to the task dependencies
     task = buffer_add_to_task(buf, &command_group_handler, is_write_access());
+    // Let the kernel iterate in the memory order of the buffer
+    if constexpr (Dimensions > 1)
+      task->add_access_layout(facade::contiguous_dimension(), Dimensions,
+                              facade::get_size());
   }
 
   /** Register the accessor once a \c std::shared_ptr is created on it
@@ -161,7 +175,7 @@ class accessor
   }
 
   /// Get the buffer used to create the accessor
-  detail::buffer<T, Dimensions>& get_buffer() { return *buf; }
+  detail::buffer<T, Dimensions, Layout>& get_buffer() { return *buf; }
 
   /** Test if the accessor has a read access right
 
@@ -226,7 +240,7 @@ class accessor
 
 protected:
   /// Set later the current buffer associated to this accessor
-  void set_buffer(std::shared_ptr<detail::buffer<T, Dimensions>> b) {
+  void set_buffer(std::shared_ptr<detail::buffer<T, Dimensions, Layout>> b) {
     buf = b;
   }
 };
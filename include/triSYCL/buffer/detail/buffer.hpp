@@ -32,20 +32,24 @@ namespace trisycl::detail {
 
 /** A SYCL buffer is a multidimensional variable length array (à la C99
     VLA or even Fortran before) that is used to store data to work on.
+
+    The default value of the Layout parameter is given by the forward
+    declaration in triSYCL/buffer/detail/accessor.hpp
 */
-template <typename T, int Dimensions = 1>
+template <typename T, int Dimensions = 1, typename Layout>
 class buffer
     : public detail::buffer_base
-    , public mixin::accessor<T, Dimensions>
-    , public detail::debug<buffer<T, Dimensions>> {
+    , public mixin::accessor<T, Dimensions, Layout>
+    , public detail::debug<buffer<T, Dimensions, Layout>> {
  private:
   // To access directly some accessor aspects here
-  using mixin = mixin::accessor<T, Dimensions>;
+  using mixin = mixin::accessor<T, Dimensions, Layout>;
 
   // \todo Replace U and D somehow by T and Dimensions
   // To allow allocation access
   template <typename U, int D, access::mode Mode,
-            access::target Target /* = access::global_buffer */>
+            access::target Target /* = access::global_buffer */,
+            typename L>
   friend class detail::accessor;
 
   /** The allocator to be used when some memory is needed
@@ -87,7 +91,7 @@ class buffer
   /// Create a new read-write buffer of size \param r
   buffer(const range<Dimensions>& r)
       /// \todo Lazily allocate memory since it might not be used on host
-      : mixin { allocate_buffer(r), r } {}
+      : mixin { allocate_buffer(r.size()), r } {}
 
   /** Create a new read-write buffer from \param host_data of size
       \param r without further allocation */
@@ -121,6 +125,16 @@ class buffer
          access is created, data are copied before to be modified. */
       copy_if_modified { true } {}
 
+  /** Create a new read-write buffer from \param host_data laid out
+      according to the mapping \param m without further allocation
+
+      This allows for example to work in place on column-major data
+      with a std::layout_left mapping or on a strided view.
+  */
+  buffer(T* host_data, const typename mixin::mapping_type& m)
+      : mixin { host_data, m }
+      , data_host { true } {}
+
   /** Create a new buffer with associated memory, using the data in
       host_data
 
@@ -204,13 +218,13 @@ class buffer
         copy_if_modified = false;
         // Since the mixin store the geometry, keep a copy before updating
         auto current_access = mixin::access;
-        /* The range is actually computed from \c access itself, so
-           save it */
-        auto current_range = mixin::get_range();
-        allocate_buffer(current_range);
+        /* Allocate the whole span of the layout, which may be larger
+           than the number of elements with some strides */
+        allocate_buffer(mixin::get_count());
         /* Update the mixin accessor to point to the new allocated
-           memory instead */
-        mixin::update(allocation, current_range);
+           memory instead, with the same layout */
+        mixin::set_access(
+            typename mixin::mdspan { allocation, current_access.mapping() });
         // Then copy the read-only data to the new allocated place
         std::uninitialized_copy_n(current_access.data_handle(), mixin::get_count(),
                                   mixin::data());
@@ -255,9 +269,8 @@ class buffer
   }
 
  private:
-  /// Allocate uninitialized buffer memory
-  auto allocate_buffer(const range<Dimensions>& r) {
-    auto count = r.size();
+  /// Allocate uninitialized buffer memory for count elements
+  auto allocate_buffer(std::size_t count) {
     // Allocate uninitialized memory
     allocation = alloc.allocate(count);
     return allocation;
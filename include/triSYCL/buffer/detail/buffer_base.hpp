@@ -22,9 +22,11 @@
 #include <mutex>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "triSYCL/command_group/detail/task.hpp"
 #include "triSYCL/context.hpp"
+#include "triSYCL/queue/detail/queue.hpp"
 
 namespace trisycl {
 
@@ -56,6 +58,12 @@ struct buffer_base : public std::enable_shared_from_this<buffer_base> {
   /// To protect the access to latest_producer
   std::mutex latest_producer_mutex;
 
+  /** The queues with some tasks using this buffer but deferred by a
+      kernel fusion, to be flushed before waiting for this buffer */
+  std::vector<std::weak_ptr<detail::queue>> deferring_queues;
+  /// To protect the access to deferring_queues
+  std::mutex deferring_queues_mutex;
+
   /// To signal when this buffer ready
   std::condition_variable ready;
   /// To protect the access to the condition variable
@@ -98,6 +106,8 @@ struct buffer_base : public std::enable_shared_from_this<buffer_base> {
 
   /// Wait for this buffer to be ready, which is no longer in use
   void wait() {
+    // Execute the deferred tasks using this buffer to avoid a deadlock
+    flush_deferred_users();
     std::unique_lock<std::mutex> ul { ready_mutex };
     ready.wait(ul, [&] {
         // When there is no producer for this buffer, we are ready to use it
@@ -106,6 +116,29 @@ struct buffer_base : public std::enable_shared_from_this<buffer_base> {
   }
 
 
+  /// Remember that a task using this buffer is deferred on a queue
+  void add_deferring_queue(const std::shared_ptr<detail::queue> &q) {
+    std::lock_guard<std::mutex> lg { deferring_queues_mutex };
+    for (auto &d : deferring_queues)
+      if (d.lock() == q)
+        return;
+    deferring_queues.push_back(q);
+  }
+
+
+  /// Execute the deferred tasks using this buffer, if any
+  void flush_deferred_users() {
+    std::vector<std::weak_ptr<detail::queue>> queues;
+    {
+      std::lock_guard<std::mutex> lg { deferring_queues_mutex };
+      queues.swap(deferring_queues);
+    }
+    for (auto &d : queues)
+      if (auto q = d.lock())
+        q->flush_deferred();
+  }
+
+
   /// Mark this buffer in use by a task
   void use() {
     // Increment the use count
@@ -27,13 +27,17 @@ namespace trisycl::detail {
 */
 template <typename T,
           int Dimensions = 1,
-          typename Allocator = buffer_allocator<std::remove_const_t<T>>>
+          typename Allocator = buffer_allocator<std::remove_const_t<T>>,
+          typename Layout = std::layout_right>
 class buffer_waiter :
     public detail::shared_ptr_implementation<buffer_waiter<T,
                                                            Dimensions,
-                                                           Allocator>,
-                                             detail::buffer<T, Dimensions>>,
-    detail::debug<buffer_waiter<T, Dimensions, Allocator>> {
+                                                           Allocator,
+                                                           Layout>,
+                                             detail::buffer<T,
+                                                            Dimensions,
+                                                            Layout>>,
+    detail::debug<buffer_waiter<T, Dimensions, Allocator, Layout>> {
 
   // The type encapsulating the implementation
   using implementation_t = typename buffer_waiter::shared_ptr_implementation;
@@ -47,7 +51,8 @@ public:
   using implementation_t::implementation;
 
   /// Create a new buffer_waiter on top of a detail::buffer
-  buffer_waiter(detail::buffer<T, Dimensions> *b) : implementation_t { b } {}
+  buffer_waiter(detail::buffer<T, Dimensions, Layout> *b)
+    : implementation_t { b } {}
 
 
   /** The buffer_waiter destructor waits for any data to be written
@@ -73,9 +78,10 @@ public:
 /// Helper function to create a new buffer_waiter
 template <typename T,
           int Dimensions = 1,
-          typename Allocator = buffer_allocator<std::remove_const_t<T>>>
-inline auto waiter(detail::buffer<T, Dimensions> *b) {
-  return new buffer_waiter<T, Dimensions, Allocator> { b };
+          typename Allocator = buffer_allocator<std::remove_const_t<T>>,
+          typename Layout = std::layout_right>
+inline auto waiter(detail::buffer<T, Dimensions, Layout> *b) {
+  return new buffer_waiter<T, Dimensions, Allocator, Layout> { b };
 }
 
 /// @} End the data Doxygen group
@@ -10,9 +10,12 @@
 */
 
 #include <condition_variable>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #ifdef TRISYCL_OPENCL
@@ -21,6 +24,7 @@
 
 #include "triSYCL/accessor/detail/accessor_base.hpp"
 #include "triSYCL/buffer/detail/buffer_base.hpp"
+#include "triSYCL/detail/binary_log.hpp"
 #include "triSYCL/detail/debug.hpp"
 #include "triSYCL/kernel.hpp"
 #include "triSYCL/queue/detail/queue.hpp"
@@ -54,6 +58,54 @@ struct task : public std::enable_shared_from_this<task>,
   /// Store if the execution ended, to be notified by task_ready
   bool execution_ended = false;
 
+  /** Store if some execution has been scheduled for this task
+
+      A command group may have no kernel at all, so there is nothing
+      to wait for in this case */
+  bool scheduled = false;
+
+  /** Store if this task is only recorded into a command graph instead
+      of being executed
+
+      In this case the kernel and the data accesses are just kept to be
+      replayed later by the graph. */
+  bool recording = false;
+
+  /// The kernel of a recorded task, to be run by a command graph
+  std::function<void(void)> recorded_kernel;
+
+  /// The buffers accessed by a recorded task with their write mode
+  std::vector<std::pair<std::shared_ptr<detail::buffer_base>, bool>>
+  recorded_buffers;
+
+  /** The unified shared memory pointers accessed by a recorded task
+      with their write mode */
+  std::vector<std::pair<const void *, bool>> recorded_pointers;
+
+  /// The range of a recorded parallel_for on a range<>, if any
+  std::vector<std::size_t> recorded_range;
+
+  /** The kernel of a recorded parallel_for on a range<> restricted to
+      the [begin, end) slice of the outermost dimension
+
+      This is used by the kernel fusion to interleave the kernels by
+      blocks. */
+  std::function<void(std::size_t, std::size_t)> recorded_slice;
+
+  /** Store if this recorded task is deferred to be executed later by
+      a kernel fusion, so that it can still be waited for */
+  bool deferred = false;
+
+  /** The number of bytes of the multi-dimensional buffers accessed
+      with their first dimension contiguous in memory, as with
+      std::layout_left */
+  std::size_t first_dimension_contiguous_bytes = 0;
+
+  /** The number of bytes of the multi-dimensional buffers accessed
+      with their last dimension contiguous in memory, as with
+      std::layout_right */
+  std::size_t last_dimension_contiguous_bytes = 0;
+
   /// To signal when this task is ready
   std::condition_variable ready;
 
@@ -79,8 +131,43 @@ struct task : public std::enable_shared_from_this<task>,
     : owner_queue { q } {}
 
 
+  /** Keep track of the memory layout of a buffer accessed by the
+      kernel, to choose the loop order of a parallel_for
+
+      \param[in] contiguous is the dimension with the smallest stride
+
+      \param[in] dimensions is the number of dimensions of the buffer
+
+      \param[in] bytes is the size of the buffer, to weight its choice
+  */
+  void add_access_layout(std::size_t contiguous,
+                         std::size_t dimensions,
+                         std::size_t bytes) {
+    if (contiguous == 0)
+      first_dimension_contiguous_bytes += bytes;
+    else if (contiguous == dimensions - 1)
+      last_dimension_contiguous_bytes += bytes;
+  }
+
+
+  /** Test if a parallel_for should iterate on the first dimension in
+      the innermost loop to have unit-stride accesses
+
+      This is the case when most of the accessed data are laid out in
+      column-major order.
+  */
+  bool iterate_first_dimension_innermost() const {
+    return first_dimension_contiguous_bytes > last_dimension_contiguous_bytes;
+  }
+
+
   /// Add a new task to the task graph and schedule for execution
   void schedule(std::function<void(void)> f) {
+    if (recording) {
+      // Just keep the kernel for a later replay by a command graph
+      recorded_kernel = std::move(f);
+      return;
+    }
     /* To keep a copy of the task shared_ptr after the end of the
        command group, capture it by copy in the following lambda.
     */
@@ -88,7 +175,7 @@ struct task : public std::enable_shared_from_this<task>,
       // Wait for the required tasks to be ready
       task->wait_for_producers();
       task->prelude();
-      TRISYCL_DUMP_T("Execute the kernel");
+      TRISYCL_BLOG(task, 2, "Task {} executes the kernel", task.get());
       // Execute the kernel
       f();
       task->postlude();
@@ -98,7 +185,7 @@ struct task : public std::enable_shared_from_this<task>,
       task->notify_consumers();
       // Notify the queue we are done
       task->owner_queue->kernel_end();
-      TRISYCL_DUMP_T("Task thread exit");
+      TRISYCL_BLOG(task, 2, "Task {} thread exit", task.get());
     };
     /* Notify the queue that there is a kernel submitted to the
        queue. Do not do it in the task contructor so that we can deal
@@ -106,6 +193,7 @@ struct task : public std::enable_shared_from_this<task>,
        thread, the queue may have finished before the thread is
        scheduled */
     owner_queue->kernel_start();
+    scheduled = true;
     /* \todo it may be implementable with packaged_task that would
        deal with exceptions in kernels
     */
@@ -113,7 +201,7 @@ struct task : public std::enable_shared_from_this<task>,
     /* If in asynchronous execution mode, execute the functor in a new
        thread */
     std::thread thread(execution);
-    TRISYCL_DUMP_T("Task thread started");
+    TRISYCL_BLOG(task, 2, "Task {} thread started", this);
     /** Detach the thread since it will synchronize by its own means
 
         \todo This is an issue if there is an exception in the kernel
@@ -128,7 +216,7 @@ struct task : public std::enable_shared_from_this<task>,
 
   /// Wait for the required producer tasks to be ready
   void wait_for_producers() {
-    TRISYCL_DUMP_T("Task " << this << " waits for the producer tasks");
+    TRISYCL_BLOG(task, 2, "Task {} waits for the producer tasks", this);
     for (auto &t : producer_tasks)
       t->wait();
     // We can let the producers rest in peace
@@ -138,7 +226,7 @@ struct task : public std::enable_shared_from_this<task>,
 
   /// Release the buffers that have  been used by this task
   void release_buffers() {
-    TRISYCL_DUMP_T("Task " << this << " releases the written buffers");
+    TRISYCL_BLOG(task, 2, "Task {} releases the written buffers", this);
     for (auto b: buffers_in_use)
       b->release();
     buffers_in_use.clear();
@@ -147,7 +235,7 @@ struct task : public std::enable_shared_from_this<task>,
 
   /// Notify the waiting tasks that we are done
   void notify_consumers() {
-    TRISYCL_DUMP_T("Notify all the task waiting for this task " << this);
+    TRISYCL_BLOG(task, 2, "Notify all the task waiting for this task {}", this);
    {
      std::unique_lock<std::mutex> ul { ready_mutex };
      execution_ended = true;
@@ -163,9 +251,17 @@ struct task : public std::enable_shared_from_this<task>,
       This is to be called from another thread
   */
   void wait() {
-    TRISYCL_DUMP_T("The task wait for task " << this << " to end");
+    TRISYCL_BLOG(task, 2, "The task wait for task {} to end", this);
     std::unique_lock<std::mutex> ul { ready_mutex };
-    ready.wait(ul, [&] { return execution_ended; });
+    if (deferred && !execution_ended) {
+      // Make sure the kernel fusion does not keep this task pending
+      ul.unlock();
+      owner_queue->flush_deferred();
+      ul.lock();
+    }
+    /* A recorded task is never executed by itself, so do not wait for
+       it, unless it is deferred */
+    ready.wait(ul, [&] { return execution_ended || (recording && !deferred); });
   }
 
 
@@ -175,7 +271,28 @@ struct task : public std::enable_shared_from_this<task>,
   */
   void add_buffer(std::shared_ptr<detail::buffer_base> &buf,
                   bool is_write_mode) {
-    TRISYCL_DUMP_T("Add buffer " << buf << " in task " << this);
+    TRISYCL_BLOG(task, 2, "Add buffer {} in task {}", buf.get(), this);
+    if (recording) {
+      /* The dependencies are resolved by the command graph when it is
+         finalized and replayed, or by track_buffer() when the task is
+         deferred by a kernel fusion */
+      recorded_buffers.emplace_back(buf, is_write_mode);
+      return;
+    }
+    track_buffer(buf, is_write_mode);
+  }
+
+
+  /** Add a buffer used by this task in the dependency graph
+
+      This is also used for a task deferred by a kernel fusion, so that
+      the rest of the program still waits for it.
+  */
+  void track_buffer(std::shared_ptr<detail::buffer_base> &buf,
+                    bool is_write_mode) {
+    if (deferred)
+      // Waiting for the buffer has to execute this task first
+      buf->add_deferring_queue(owner_queue);
     /* Keep track of the use of the buffer to notify its release at
        the end of the execution */
     buffers_in_use.push_back(buf);
@@ -204,9 +321,21 @@ struct task : public std::enable_shared_from_this<task>,
   }
 
 
+  /** Add an explicit dependency on another task
+
+      This is used by the explicit \c handler::depends_on and by the
+      unified shared memory pointer tracking. A null task or the task
+      itself are just ignored.
+  */
+  void add_dependency(const std::shared_ptr<detail::task> &t) {
+    if (t && t != shared_from_this())
+      producer_tasks.push_back(t);
+  }
+
+
   /// Execute the prologues
   void prelude() {
-    TRISYCL_DUMP_T("task::prelude");
+    TRISYCL_BLOG(task, 3, "task {} prelude", this);
 
     for (const auto &p : prologues)
       p();
@@ -228,7 +357,7 @@ struct task : public std::enable_shared_from_this<task>,
 
   /// Add a function to the prelude to run before kernel execution
   void add_prelude(const std::function<void(void)> &f) {
-    TRISYCL_DUMP_T("task::add_prelude");
+    TRISYCL_BLOG(task, 3, "task {} add_prelude", this);
 
     prologues.push_back(f);
   }
@@ -0,0 +1,513 @@
+#ifndef TRISYCL_SYCL_DETAIL_BINARY_LOG_HPP
+#define TRISYCL_SYCL_DETAIL_BINARY_LOG_HPP
+
+/** \file A low-overhead binary logger for the hot paths of the runtime
+
+    A log message is emitted with
+
+    \code
+    TRISYCL_BLOG(router, 3, "routing {} from tile ({},{})", v, x, y);
+    \endcode
+
+    where the format string is a literal with a {} per argument,
+    checked at compile time. Only the address of the static description
+    of the call site, a timestamp and the raw values of the arguments
+    are copied into a ring buffer owned by the current thread, without
+    any formatting, memory allocation or lock. When the ring buffer is
+    full the oldest messages are overwritten, so only the latest
+    messages of each thread are kept, like with a flight recorder.
+
+    The arguments can be integers, enumerations, floating-point
+    numbers, booleans, characters or pointers, which are displayed as
+    an address. Strings are not supported since only their address
+    could be kept.
+
+    A message is recorded only when its level is lower or equal to the
+    verbosity level of its subsystem, which is 0 by default. The levels
+    are set at run-time with set_level() or with the TRISYCL_BLOG
+    environment variable, such as TRISYCL_BLOG=router:3,pipe:1 or
+    TRISYCL_BLOG=all:2, a subsystem without a level meaning all the
+    levels.
+
+    The messages are written in a binary form into the file named by
+    the TRISYCL_BLOG_FILE environment variable, trisycl.blog by default,
+    at the end of the program or when calling dump(). The file is
+    decoded offline into text with decode(), for example with the
+    triSYCL_blog_decode tool.
+
+    Ronan at Keryell point FR
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace trisycl::detail::binary_log {
+
+/** \addtogroup debug_trace Debugging and tracing support
+    @{
+*/
+
+/// The parts of the runtime with their own verbosity level
+enum class subsystem : std::uint8_t {
+  general,
+  task,
+  pipe,
+  router,
+  aie,
+};
+
+/// The names of the subsystems, as used in the TRISYCL_BLOG variable
+inline constexpr std::array<std::string_view, 5> subsystem_names {
+  "general", "task", "pipe", "router", "aie"
+};
+
+/// The maximum number of arguments of a message
+inline constexpr std::size_t max_args = 6;
+
+/// The number of messages kept per thread, a power of 2
+inline constexpr std::size_t ring_size = 1 << 14;
+
+/// The kinds of argument values, to decode them
+enum class arg_type : std::uint8_t {
+  signed_integer,
+  unsigned_integer,
+  floating_point,
+  boolean,
+  character,
+  pointer,
+};
+
+/// The static description of a call site
+struct site {
+  const char* format;
+  const char* file;
+  int line;
+  subsystem sub;
+  int level;
+};
+
+/// Count the {} placeholders in a format string
+constexpr std::size_t count_placeholders(std::string_view format) {
+  std::size_t n = 0;
+  for (auto p = format.find("{}"); p != format.npos;
+       p = format.find("{}", p + 2))
+    ++n;
+  return n;
+}
+
+/// The description of a call site with the types of its arguments
+struct descriptor {
+  const site* s;
+  std::uint8_t nargs;
+  std::array<arg_type, max_args> types;
+};
+
+/// A message as stored in the ring buffer, 64 bytes on 64-bit machines
+struct record {
+  const descriptor* d;
+  /// Nanoseconds since the start of the logger
+  std::uint64_t time;
+  std::array<std::uint64_t, max_args> args;
+};
+
+/// Get the kind of an argument type
+template <typename T> constexpr arg_type type_of() {
+  using U = std::remove_cvref_t<T>;
+  if constexpr (std::is_same_v<U, bool>)
+    return arg_type::boolean;
+  else if constexpr (std::is_same_v<U, char>)
+    return arg_type::character;
+  else if constexpr (std::is_enum_v<U>)
+    return type_of<std::underlying_type_t<U>>();
+  else if constexpr (std::is_integral_v<U>)
+    return std::is_signed_v<U> ? arg_type::signed_integer
+                               : arg_type::unsigned_integer;
+  else if constexpr (std::is_floating_point_v<U>)
+    return arg_type::floating_point;
+  else if constexpr (std::is_pointer_v<U> || std::is_null_pointer_v<U>)
+    return arg_type::pointer;
+  else
+    static_assert(!sizeof(U), "This type cannot be logged, only scalar "
+                  "values and pointers can");
+}
+
+/// Get the raw value of an argument
+template <typename T> std::uint64_t encode(const T& v) {
+  using U = std::remove_cvref_t<T>;
+  if constexpr (std::is_enum_v<U>)
+    return encode(static_cast<std::underlying_type_t<U>>(v));
+  else if constexpr (std::is_floating_point_v<U>)
+    return std::bit_cast<std::uint64_t>(static_cast<double>(v));
+  else if constexpr (std::is_pointer_v<U>)
+    return reinterpret_cast<std::uintptr_t>(v);
+  else if constexpr (std::is_null_pointer_v<U>)
+    return 0;
+  else
+    // Sign-extended for the signed integers
+    return static_cast<std::uint64_t>(v);
+}
+
+/// The messages of a thread
+class ring {
+  std::unique_ptr<record[]> slots { new record[ring_size] };
+
+  /// The total number of messages pushed so far
+  std::atomic<std::uint64_t> pushed = 0;
+
+ public:
+  /// The number of the thread, in creation order
+  const std::uint32_t thread;
+
+  ring(std::uint32_t thread)
+      : thread { thread } {}
+
+  /// Add a message, only called by the owning thread
+  void push(const record& r) {
+    auto n = pushed.load(std::memory_order_relaxed);
+    slots[n & (ring_size - 1)] = r;
+    pushed.store(n + 1, std::memory_order_release);
+  }
+
+  /// Apply a function on the messages kept, from the oldest
+  template <typename F> void for_each(F&& f) const {
+    auto n = pushed.load(std::memory_order_acquire);
+    for (auto i = n > ring_size ? n - ring_size : 0; i < n; ++i)
+      f(slots[i & (ring_size - 1)]);
+  }
+};
+
+/// The logger shared by all the threads
+class logger {
+  std::array<std::atomic<int>, subsystem_names.size()> levels {};
+
+  /// Protect the list of the rings
+  std::mutex m;
+
+  std::vector<std::shared_ptr<ring>> rings;
+
+  std::string file_name = "trisycl.blog";
+
+  std::chrono::steady_clock::time_point origin =
+      std::chrono::steady_clock::now();
+
+  logger() {
+    if (auto f = std::getenv("TRISYCL_BLOG_FILE"))
+      file_name = f;
+    if (auto l = std::getenv("TRISYCL_BLOG"))
+      set_levels(l);
+  }
+
+  ~logger() {
+    if (std::ranges::any_of(levels, [](auto& l) { return l > 0; }))
+      dump(file_name);
+  }
+
+ public:
+  /// The logger is a singleton
+  static logger& instance() {
+    static logger l;
+    return l;
+  }
+
+  /// Test whether a message of some level is to be recorded
+  bool is_enabled(subsystem s, int level) const {
+    return levels[static_cast<int>(s)].load(std::memory_order_relaxed)
+        >= level;
+  }
+
+  /// Set the verbosity level of a subsystem
+  void set_level(subsystem s, int level) {
+    levels[static_cast<int>(s)] = level;
+  }
+
+  /// Set the verbosity levels from a string like "router:3,pipe:1"
+  void set_levels(std::string_view spec) {
+    while (!spec.empty()) {
+      auto item = spec.substr(0, spec.find(','));
+      spec.remove_prefix(std::min(spec.size(), item.size() + 1));
+      auto name = item.substr(0, item.find(':'));
+      int level = std::numeric_limits<int>::max();
+      if (name.size() < item.size())
+        std::from_chars(item.data() + name.size() + 1,
+                        item.data() + item.size(), level);
+      for (std::size_t s = 0; s < subsystem_names.size(); ++s)
+        if (name == "all" || name == subsystem_names[s])
+          levels[s] = level;
+    }
+  }
+
+  /// Get the ring buffer of the current thread
+  ring& local_ring() {
+    thread_local std::shared_ptr<ring> r = [&] {
+      std::lock_guard lock { m };
+      return rings.emplace_back(std::make_shared<ring>(rings.size()));
+    }();
+    return *r;
+  }
+
+  /// Get the time of a message
+  std::uint64_t now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - origin)
+        .count();
+  }
+
+  /** Write the messages kept so far in binary form
+
+      The messages being recorded concurrently may be corrupted, so it
+      is better to dump when the logging threads are quiet.
+  */
+  void dump(std::ostream& o) {
+    auto put = [&](auto v) {
+      o.write(reinterpret_cast<const char*>(&v), sizeof(v));
+    };
+    auto put_string = [&](std::string_view s) {
+      put(static_cast<std::uint32_t>(s.size()));
+      o.write(s.data(), s.size());
+    };
+    std::lock_guard lock { m };
+    // Number the descriptors used by the messages
+    std::map<const descriptor*, std::uint32_t> ids;
+    std::uint64_t count = 0;
+    for (auto& r : rings)
+      r->for_each([&](const record& e) {
+        ids.try_emplace(e.d, ids.size());
+        ++count;
+      });
+    o.write("TSBLOG1\n", 8);
+    put(static_cast<std::uint32_t>(ids.size()));
+    for (auto& [d, id] : ids) {
+      put(id);
+      put_string(d->s->format);
+      put_string(d->s->file);
+      put(static_cast<std::int32_t>(d->s->line));
+      put(d->s->sub);
+      put(static_cast<std::int32_t>(d->s->level));
+      put(d->nargs);
+      for (int i = 0; i < d->nargs; ++i)
+        put(d->types[i]);
+    }
+    put(count);
+    for (auto& r : rings)
+      r->for_each([&](const record& e) {
+        put(ids[e.d]);
+        put(r->thread);
+        put(e.time);
+        for (int i = 0; i < e.d->nargs; ++i)
+          put(e.args[i]);
+      });
+  }
+
+  /// Write the messages kept so far in binary form into a file
+  void dump(const std::string& name) {
+    std::ofstream o { name, std::ios::binary };
+    dump(o);
+  }
+};
+
+/// Test whether a call site is to be recorded
+inline bool is_enabled(const site& s) {
+  return logger::instance().is_enabled(s.sub, s.level);
+}
+
+/// Set the verbosity level of a subsystem
+inline void set_level(subsystem s, int level) {
+  logger::instance().set_level(s, level);
+}
+
+/// Write the messages kept so far in binary form
+inline void dump(std::ostream& o) { logger::instance().dump(o); }
+
+/// Record a message of a call site
+template <const site& S, typename... Args> void log(const Args&... args) {
+  static_assert(sizeof...(Args) <= max_args, "Too many arguments to log");
+  static_assert(count_placeholders(S.format) == sizeof...(Args),
+                "The number of {} in the format string does not match "
+                "the number of arguments");
+  static constexpr descriptor d { &S, sizeof...(Args), { type_of<Args>()... } };
+  auto& l = logger::instance();
+  l.local_ring().push({ &d, l.now(), { encode(args)... } });
+}
+
+/** Decode into text the messages written by dump()
+
+    The messages of all the threads are merged by time and written one
+    per line as: time in ns, thread number, subsystem, source location
+    and formatted message.
+
+    \throws std::runtime_error if the input is not a valid log
+*/
+inline void decode(std::istream& in, std::ostream& out) {
+  auto get = [&]<typename T>(T& v) {
+    if (!in.read(reinterpret_cast<char*>(&v), sizeof(v)))
+      throw std::runtime_error { "binary_log::decode: truncated input" };
+  };
+  auto get_string = [&] {
+    std::uint32_t size;
+    get(size);
+    std::string s(size, '\0');
+    if (!in.read(s.data(), size))
+      throw std::runtime_error { "binary_log::decode: truncated input" };
+    return s;
+  };
+  std::array<char, 8> magic;
+  if (!in.read(magic.data(), magic.size())
+      || std::string_view { magic.data(), magic.size() } != "TSBLOG1\n")
+    throw std::runtime_error { "binary_log::decode: not a binary log" };
+
+  struct call_site {
+    std::string format;
+    std::string file;
+    std::int32_t line;
+    subsystem sub;
+    std::int32_t level;
+    std::vector<arg_type> types;
+  };
+  std::uint32_t nsites;
+  get(nsites);
+  std::vector<call_site> sites(nsites);
+  for (std::uint32_t i = 0; i < nsites; ++i) {
+    std::uint32_t id;
+    get(id);
+    if (id >= nsites)
+      throw std::runtime_error { "binary_log::decode: invalid call site" };
+    auto& c = sites[id];
+    c.format = get_string();
+    c.file = std::filesystem::path(get_string()).filename();
+    get(c.line);
+    get(c.sub);
+    get(c.level);
+    std::uint8_t nargs;
+    get(nargs);
+    // Each argument is stored in a fixed array and replaces a {}
+    if (nargs > max_args || count_placeholders(c.format) != nargs)
+      throw std::runtime_error { "binary_log::decode: invalid call site" };
+    c.types.resize(nargs);
+    for (auto& t : c.types)
+      get(t);
+  }
+
+  struct message {
+    std::uint64_t time;
+    std::uint32_t thread;
+    std::uint32_t site;
+    std::array<std::uint64_t, max_args> args;
+  };
+  std::uint64_t count;
+  get(count);
+  std::vector<message> messages;
+  for (std::uint64_t i = 0; i < count; ++i) {
+    message m;
+    get(m.site);
+    if (m.site >= nsites)
+      throw std::runtime_error { "binary_log::decode: invalid call site" };
+    get(m.thread);
+    get(m.time);
+    for (std::size_t a = 0; a < sites[m.site].types.size(); ++a)
+      get(m.args[a]);
+    messages.push_back(m);
+  }
+  std::ranges::stable_sort(messages, {}, &message::time);
+
+  auto format_arg = [](arg_type t, std::uint64_t v) -> std::string {
+    switch (t) {
+    case arg_type::signed_integer:
+      return std::to_string(static_cast<std::int64_t>(v));
+    case arg_type::unsigned_integer:
+      return std::to_string(v);
+    case arg_type::floating_point: {
+      std::array<char, 32> b;
+      auto r = std::to_chars(b.data(), b.data() + b.size(),
+                             std::bit_cast<double>(v));
+      return { b.data(), r.ptr };
+    }
+    case arg_type::boolean:
+      return v ? "true" : "false";
+    case arg_type::character:
+      return std::string(1, static_cast<char>(v));
+    case arg_type::pointer: {
+      std::array<char, 16> b;
+      auto r = std::to_chars(b.data(), b.data() + b.size(), v, 16);
+      return "0x" + std::string { b.data(), r.ptr };
+    }
+    }
+    return "?";
+  };
+  for (auto& m : messages) {
+    auto& c = sites[m.site];
+    auto sub = static_cast<std::size_t>(c.sub) < subsystem_names.size()
+                   ? subsystem_names[static_cast<std::size_t>(c.sub)]
+                   : "?";
+    out << m.time << " [" << m.thread << "] " << sub << ' ' << c.file << ':'
+        << c.line << ' ';
+    std::string_view f = c.format;
+    for (std::size_t a = 0; a < c.types.size(); ++a) {
+      auto p = f.find("{}");
+      out << f.substr(0, p) << format_arg(c.types[a], m.args[a]);
+      f.remove_prefix(p + 2);
+    }
+    out << f << '\n';
+  }
+}
+
+/// @} End the debug_trace Doxygen group
+
+}
+
+/// The device has no logging infrastructure, so nothing is logged there
+#if defined(__SYCL_DEVICE_ONLY__)
+#define TRISYCL_BLOG(SUBSYSTEM, LEVEL, FORMAT, ...) do { } while (0)
+#else
+/** Record a message in the binary log
+
+    \param SUBSYSTEM is the name of the subsystem in
+    trisycl::detail::binary_log::subsystem
+
+    \param LEVEL is the verbosity level from which the message is
+    recorded
+
+    \param FORMAT is a string literal with a {} per argument
+*/
+#define TRISYCL_BLOG(SUBSYSTEM, LEVEL, FORMAT, ...)                            \
+  do {                                                                         \
+    static constexpr ::trisycl::detail::binary_log::site trisycl_blog_site {   \
+      FORMAT, __FILE__, __LINE__,                                              \
+      ::trisycl::detail::binary_log::subsystem::SUBSYSTEM, LEVEL               \
+    };                                                                         \
+    if (::trisycl::detail::binary_log::is_enabled(trisycl_blog_site))          \
+      ::trisycl::detail::binary_log::log<trisycl_blog_site>(__VA_ARGS__);      \
+  } while (0)
+#endif
+
+/*
+    # Some Emacs stuff:
+    ### Local Variables:
+    ### ispell-local-dictionary: "american"
+    ### eval: (flyspell-prog-mode)
+    ### End:
+*/
+
+#endif // TRISYCL_SYCL_DETAIL_BINARY_LOG_HPP
@@ -52,8 +52,15 @@ private:
   /// The thread running the Boost.Fiber schedulers to do the work
   std::vector<std::future<void>> working_threads;
 
-  /// The queue to submit work
-  boost::fibers::unbuffered_channel<std::function<void(void)>> submission;
+  /** The queue to submit work
+
+      Use a buffered channel so that a submitter does not have to wait
+      for the scheduling thread to take each work, which would slow
+      down the launch of many fibers. The capacity has to be a power
+      of 2 */
+  boost::fibers::buffered_channel<std::function<void(void)>> submission {
+    1024
+  };
 
   //static auto constexpr starting_mode = boost::fibers::launch::post;
   static auto constexpr starting_mode = boost::fibers::launch::dispatch;
@@ -0,0 +1,103 @@
+#ifndef TRISYCL_SYCL_DEVICE_EVENT_HPP
+#define TRISYCL_SYCL_DEVICE_EVENT_HPP
+
+/** \file The OpenCL SYCL device_event and the host implementation of
+    the work-group asynchronous copies and prefetch
+
+    Ronan at Keryell point FR
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace trisycl {
+
+/** \addtogroup parallelism Expressing parallelism through kernels
+    @{
+*/
+
+/** An event to wait for the completion of an asynchronous copy inside
+    a kernel
+
+    On the host the copies are done in bulk when they are issued, so
+    there is nothing left to wait for.
+*/
+class device_event {
+
+public:
+
+  /// Wait for the asynchronous operation to complete
+  void wait() const {}
+
+};
+
+/// @} End the parallelism Doxygen group
+
+namespace detail {
+
+/** \addtogroup parallelism
+    @{
+*/
+
+/** Copy some elements between the global and the local memory
+
+    The contiguous case uses a bulk copy.
+
+    \param[in] dest_stride is the stride between elements in \a dest
+
+    \param[in] src_stride is the stride between elements in \a src
+*/
+template <typename T>
+void work_group_copy(T *dest,
+                     const T *src,
+                     std::size_t num_elements,
+                     std::size_t dest_stride = 1,
+                     std::size_t src_stride = 1) {
+  if (dest_stride == 1 && src_stride == 1) {
+    if constexpr (std::is_trivially_copyable_v<T>)
+      std::memcpy(dest, src, num_elements*sizeof(T));
+    else
+      std::copy_n(src, num_elements, dest);
+  }
+  else
+    for (std::size_t i = 0; i < num_elements; ++i)
+      dest[i*dest_stride] = src[i*src_stride];
+}
+
+
+/** Hint the processor to bring some elements into the cache
+
+    One prefetch instruction is issued per cache line.
+*/
+template <typename T>
+void prefetch(const T *p, std::size_t num_elements) {
+#if defined(__GNUC__) || defined(__clang__)
+  // Assume the usual 64-byte cache line
+  constexpr std::size_t cache_line = 64;
+  auto begin = reinterpret_cast<const char *>(p);
+  auto end = reinterpret_cast<const char *>(p + num_elements);
+  for (auto a = begin; a < end; a += cache_line)
+    // Read access with a high temporal locality
+    __builtin_prefetch(a, 0, 3);
+#endif
+}
+
+/// @} End the parallelism Doxygen group
+
+}
+}
+
+/*
+    # Some Emacs stuff:
+    ### Local Variables:
+    ### ispell-local-dictionary: "american"
+    ### eval: (flyspell-prog-mode)
+    ### End:
+*/
+
+#endif // TRISYCL_SYCL_DEVICE_EVENT_HPP
@@ -11,6 +11,7 @@
 #include "triSYCL/info/event.hpp"
 #include "triSYCL/event/detail/event.hpp"
 #include "triSYCL/event/detail/host_event.hpp"
+#include "triSYCL/event/detail/task_event.hpp"
 #ifdef TRISYCL_OPENCL
 #include "triSYCL/event/detail/opencl_event.hpp"
 #endif
@@ -28,6 +29,13 @@ public:
 
   event() : implementation_t { detail::host_event::instance() } {}
 
+  /** Construct an event from its implementation
+
+      This is a triSYCL implementation detail, used for example by the
+      queue to return an event tracking a submitted command group.
+  */
+  event(std::shared_ptr<detail::event> e) : implementation_t { std::move(e) } {}
+
 #ifdef TRISYCL_OPENCL
   /** Construct an event class using the clEvent from OpenCL.
 
@@ -74,8 +82,10 @@ public:
     implementation->wait();
   }
 
+  /// Wait for all the events of a list to complete
   static void wait(const vector_class<event> &eventList) {
-    TRISYCL_UNIMPL;
+    for (auto e : eventList)
+      e.wait();
   }
 
   void wait_and_throw() {
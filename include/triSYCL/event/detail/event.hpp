@@ -9,8 +9,12 @@
     License. See LICENSE.TXT for details.
 */
 
+#include <memory>
+
 namespace trisycl::detail {
 
+struct task;
+
 struct event : detail::debug<detail::event> {
 
 public:
@@ -32,6 +36,13 @@ public:
 
   virtual void wait() const = 0;
 
+  /** Return the host task behind the event, if any
+
+      This is used to build the dependency graph from the events given
+      to \c handler::depends_on
+  */
+  virtual std::shared_ptr<detail::task> get_task() const { return {}; }
+
   virtual ~event() {}
 };
 
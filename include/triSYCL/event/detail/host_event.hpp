@@ -36,8 +36,9 @@ public:
     return 0;
   }
 
+  /// The host event tracks no command, so there is nothing left to wait for
   info::event_command_status get_command_execution_status() const override {
-    return info::event_command_status::submitted;
+    return info::event_command_status::complete;
   }
 
   cl_ulong get_profiling_info(info::event_profiling param) const override {
@@ -0,0 +1,74 @@
+#ifndef TRISYCL_SYCL_EVENT_DETAIL_TASK_EVENT_HPP
+#define TRISYCL_SYCL_EVENT_DETAIL_TASK_EVENT_HPP
+
+/** \file The triSYCL event tracking a host task
+
+    Ronan at Keryell point FR
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <memory>
+#include <mutex>
+
+#include "triSYCL/command_group/detail/task.hpp"
+
+namespace trisycl::detail {
+
+/** An event tracking the execution of a command group on the host
+
+    This is what the host queue returns on submission so that other
+    command groups can depend on it with \c handler::depends_on.
+*/
+class task_event : public detail::event {
+
+  /// The task of the command group behind this event
+  std::shared_ptr<detail::task> t;
+
+public:
+
+  /// Create an event waiting for a task
+  task_event(std::shared_ptr<detail::task> t) : t { std::move(t) } {}
+
+#ifdef TRISYCL_OPENCL
+  cl_event get() const override {
+    throw non_cl_error("The host task event has no OpenCL event");
+  }
+
+  const boost::compute::event &get_boost_compute() const override {
+    throw
+      non_cl_error("The host task event has no underlying Boost Compute event");
+  }
+#endif
+
+  bool is_host() const override {
+    return true;
+  }
+
+  cl_uint get_reference_count() const override {
+    return 0;
+  }
+
+  info::event_command_status get_command_execution_status() const override {
+    std::lock_guard<std::mutex> lg { t->ready_mutex };
+    return t->execution_ended ? info::event_command_status::complete
+                              : info::event_command_status::submitted;
+  }
+
+  cl_ulong get_profiling_info(info::event_profiling param) const override {
+    return 0;
+  }
+
+  void wait() const override {
+    t->wait();
+  }
+
+  std::shared_ptr<detail::task> get_task() const override {
+    return t;
+  }
+};
+
+}
+
+#endif // TRISYCL_SYCL_EVENT_DETAIL_TASK_EVENT_HPP
@@ -12,7 +12,9 @@
 #include <cstddef>
 #include <functional>
 
+#include "triSYCL/address_space.hpp"
 #include "triSYCL/detail/linear_id.hpp"
+#include "triSYCL/device_event.hpp"
 #include "triSYCL/h_item.hpp"
 #include "triSYCL/id.hpp"
 #include "triSYCL/nd_range.hpp"
@@ -173,6 +175,58 @@ public:
   }
 
 
+  /** Asynchronously copy some elements from the global memory to the
+      local memory of the work-group
+
+      Since the work-group scope is executed once per work-group, the
+      copy is done in bulk on the host when issued.
+
+      \param[in] src_stride is the stride between the elements in the
+      global memory
+  */
+  template <typename T>
+  device_event
+  async_work_group_copy(multi_ptr<T *, access::address_space::local_space> dest,
+                        multi_ptr<T *, access::address_space::global_space> src,
+                        size_t num_elements,
+                        size_t src_stride = 1) const {
+    detail::work_group_copy<T>(dest, src, num_elements, 1, src_stride);
+    return {};
+  }
+
+
+  /** Asynchronously copy some elements from the local memory of the
+      work-group to the global memory
+
+      \param[in] dest_stride is the stride between the elements in the
+      global memory
+  */
+  template <typename T>
+  device_event
+  async_work_group_copy(multi_ptr<T *, access::address_space::global_space> dest,
+                        multi_ptr<T *, access::address_space::local_space> src,
+                        size_t num_elements,
+                        size_t dest_stride = 1) const {
+    detail::work_group_copy<T>(dest, src, num_elements, dest_stride, 1);
+    return {};
+  }
+
+
+  /// Wait for some asynchronous copies to complete
+  template <typename... EventTN>
+  void wait_for(EventTN... events) const {
+    (events.wait(), ...);
+  }
+
+
+  /// Hint the processor to bring some global memory into the cache
+  template <typename T>
+  void prefetch(multi_ptr<T *, access::address_space::global_space> p,
+                size_t num_elements) const {
+    detail::prefetch<T>(p, num_elements);
+  }
+
+
   /** Loop on the work-items inside a work-group
    */
   void parallel_for_work_item(std::function<void(h_item<rank()>)> f)
@@ -0,0 +1,400 @@
+#ifndef TRISYCL_SYCL_GROUP_ALGORITHM_HPP
+#define TRISYCL_SYCL_GROUP_ALGORITHM_HPP
+
+/** \file The SYCL 2020 group algorithms
+
+    Since in this SYCL 1.2.1 implementation nd_item::get_group() returns
+    only the group id<>, the algorithms called by the work-items of an
+    nd_range kernel take the nd_item<> of the work-item to identify its
+    work-group.
+
+    With the OpenMP execution of the work-items, each work-item
+    publishes its value in some work-group shared memory and then all
+    the values are combined by each work-item after a single barrier,
+    instead of a tree of barriers. Otherwise, as for nd_item::barrier(),
+    only the work-groups of 1 work-item are supported and the others
+    throw feature_not_supported.
+
+    In the hierarchical parallelism the joint_* algorithms are to be
+    called from the work-group scope on some memory, with a loop
+    written to be vectorized.
+
+    Ronan at Keryell point FR
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+
+#include "triSYCL/detail/linear_id.hpp"
+#include "triSYCL/exception.hpp"
+#include "triSYCL/group.hpp"
+#include "triSYCL/id.hpp"
+#include "triSYCL/nd_item.hpp"
+#include "triSYCL/parallelism/detail/group_scratch.hpp"
+
+namespace trisycl {
+
+namespace detail {
+
+/** \addtogroup parallelism
+    @{
+*/
+
+/// Test whether an operation is some instance of a standard function object
+template <typename BinaryOperation, template <typename> class StdOp>
+constexpr bool is_std_op = false;
+
+template <typename T, template <typename> class StdOp>
+constexpr bool is_std_op<StdOp<T>, StdOp> = true;
+
+
+/// Compute the identity of the usual binary operations
+template <typename BinaryOperation, typename T>
+constexpr T known_identity() {
+  if constexpr (is_std_op<BinaryOperation, std::plus>
+                || is_std_op<BinaryOperation, std::bit_or>
+                || is_std_op<BinaryOperation, std::bit_xor>)
+    return T {};
+  else if constexpr (is_std_op<BinaryOperation, std::multiplies>)
+    return T { 1 };
+  else if constexpr (is_std_op<BinaryOperation, std::bit_and>)
+    return static_cast<T>(~T {});
+  else
+    static_assert(!sizeof(T), "No known identity for this operation, "
+                  "use the version with an initial value");
+}
+
+
+/** Exchange a value between all the work-items of a work-group and
+    compute something with all the values
+
+    \param[in] compute is called with a function returning the value of
+    a work-item from its local linear id, the number of work-items and
+    the local linear id of the current work-item
+
+    \throw feature_not_supported if the work-group has more than 1
+    work-item but they are not executed by cooperating threads
+*/
+template <int Dimensions, typename T, typename Compute>
+auto group_collective(const nd_item<Dimensions> &it,
+                      const T &x,
+                      Compute compute) {
+  if (auto s = it.get_group_scratch()) {
+    auto me = it.get_local_linear_id();
+    auto bank = s->exchange(me, x);
+    return compute([&] (std::size_t i) {
+        return group_scratch::value<T>(bank, i);
+      }, s->size(), me);
+  }
+  if (it.get_local_range().size() != 1)
+    /* The work-items are not executed by cooperating threads, so they
+       cannot see each other and there is no way to compute a correct
+       result */
+    throw feature_not_supported {
+      "Group algorithms on work-groups of more than 1 work-item require "
+      "the OpenMP execution with barriers" };
+  return compute([&] (std::size_t) { return x; },
+                 std::size_t { 1 }, std::size_t { 0 });
+}
+
+
+/** Reduce a range with some independent partial results so that the
+    loop can be vectorized
+
+    The operation is assumed associative and commutative, as the SYCL
+    function objects.
+*/
+template <typename Ptr, typename T, typename BinaryOperation>
+T vectorized_reduce(Ptr first, Ptr last, T init, BinaryOperation op) {
+  // The number of independent partial results
+  constexpr std::size_t lanes = 8;
+  std::size_t n = std::distance(first, last);
+  if (n < lanes)
+    return std::accumulate(first, last, init, op);
+  std::array<T, lanes> partial;
+  for (std::size_t l = 0; l < lanes; ++l)
+    partial[l] = first[l];
+  std::size_t i = lanes;
+  for (; i + lanes <= n; i += lanes)
+    for (std::size_t l = 0; l < lanes; ++l)
+      partial[l] = op(partial[l], first[i + l]);
+  for (std::size_t l = 0; l < lanes; ++l)
+    init = op(init, partial[l]);
+  for (; i < n; ++i)
+    init = op(init, first[i]);
+  return init;
+}
+
+/// @} End the parallelism Doxygen group
+
+}
+
+/** \addtogroup parallelism
+    @{
+*/
+
+/** Broadcast the value of a work-item to all the work-items of the
+    work-group
+
+    \param[in] local_linear_id is the local linear id of the work-item
+    providing the value
+*/
+template <int Dimensions, typename T>
+T group_broadcast(const nd_item<Dimensions> &it,
+                  T x,
+                  std::size_t local_linear_id = 0) {
+  return detail::group_collective(it, x, [&] (auto value, auto, auto) {
+      return value(local_linear_id);
+    });
+}
+
+
+/// Broadcast the value of the work-item with a local id<> to the work-group
+template <int Dimensions, typename T>
+T group_broadcast(const nd_item<Dimensions> &it,
+                  T x,
+                  id<Dimensions> local_id) {
+  return group_broadcast(it, x,
+                         detail::linear_id(it.get_local_range(), local_id));
+}
+
+
+/// Combine the values of all the work-items of the work-group
+template <int Dimensions, typename T, typename BinaryOperation>
+T reduce_over_group(const nd_item<Dimensions> &it,
+                    T x,
+                    BinaryOperation op) {
+  return detail::group_collective(it, x, [&] (auto value, auto n, auto) {
+      T result = value(0);
+      for (std::size_t i = 1; i < n; ++i)
+        result = op(result, value(i));
+      return result;
+    });
+}
+
+
+/** Combine an initial value with the values of all the work-items of
+    the work-group
+*/
+template <int Dimensions, typename V, typename T, typename BinaryOperation>
+T reduce_over_group(const nd_item<Dimensions> &it,
+                    V x,
+                    T init,
+                    BinaryOperation op) {
+  return op(init, reduce_over_group(it, x, op));
+}
+
+
+/** Combine an initial value with the values of the work-items of the
+    work-group before the current one
+*/
+template <int Dimensions, typename V, typename T, typename BinaryOperation>
+T exclusive_scan_over_group(const nd_item<Dimensions> &it,
+                            V x,
+                            T init,
+                            BinaryOperation op) {
+  return detail::group_collective(it, x, [&] (auto value, auto, auto me) {
+      T result = init;
+      for (std::size_t i = 0; i < me; ++i)
+        result = op(result, value(i));
+      return result;
+    });
+}
+
+
+/** Combine the values of the work-items of the work-group before the
+    current one
+*/
+template <int Dimensions, typename T, typename BinaryOperation>
+T exclusive_scan_over_group(const nd_item<Dimensions> &it,
+                            T x,
+                            BinaryOperation op) {
+  return exclusive_scan_over_group
+    (it, x, detail::known_identity<BinaryOperation, T>(), op);
+}
+
+
+/** Combine the values of the work-items of the work-group up to the
+    current one
+*/
+template <int Dimensions, typename T, typename BinaryOperation>
+T inclusive_scan_over_group(const nd_item<Dimensions> &it,
+                            T x,
+                            BinaryOperation op) {
+  return detail::group_collective(it, x, [&] (auto value, auto, auto me) {
+      T result = value(0);
+      for (std::size_t i = 1; i <= me; ++i)
+        result = op(result, value(i));
+      return result;
+    });
+}
+
+
+/** Combine an initial value with the values of the work-items of the
+    work-group up to the current one
+*/
+template <int Dimensions, typename V, typename BinaryOperation, typename T>
+T inclusive_scan_over_group(const nd_item<Dimensions> &it,
+                            V x,
+                            BinaryOperation op,
+                            T init) {
+  return op(init, inclusive_scan_over_group(it, x, op));
+}
+
+
+/// Test whether a predicate is true for any work-item of the work-group
+template <int Dimensions>
+bool any_of_group(const nd_item<Dimensions> &it, bool pred) {
+  return detail::group_collective(it, pred, [&] (auto value, auto n, auto) {
+      bool result = false;
+      for (std::size_t i = 0; i < n; ++i)
+        result = result || value(i);
+      return result;
+    });
+}
+
+
+/// Test whether a predicate is true for all the work-items of the work-group
+template <int Dimensions>
+bool all_of_group(const nd_item<Dimensions> &it, bool pred) {
+  return !any_of_group(it, !pred);
+}
+
+
+/// Test whether a predicate is false for all the work-items of the work-group
+template <int Dimensions>
+bool none_of_group(const nd_item<Dimensions> &it, bool pred) {
+  return !any_of_group(it, pred);
+}
+
+
+/** Combine the values of a range from the work-group scope of a
+    hierarchical kernel
+
+    \todo Use the work-items of the group
+*/
+template <int Dimensions, typename Ptr, typename BinaryOperation>
+auto joint_reduce(const group<Dimensions> &,
+                  Ptr first,
+                  Ptr last,
+                  BinaryOperation op) {
+  using T = typename std::iterator_traits<Ptr>::value_type;
+  return detail::vectorized_reduce(first, last,
+                                   detail::known_identity<BinaryOperation, T>(),
+                                   op);
+}
+
+
+/// Combine an initial value with the values of a range
+template <int Dimensions, typename Ptr, typename T, typename BinaryOperation>
+T joint_reduce(const group<Dimensions> &,
+               Ptr first,
+               Ptr last,
+               T init,
+               BinaryOperation op) {
+  return detail::vectorized_reduce(first, last, init, op);
+}
+
+
+/// Compute the exclusive scan of a range with an initial value
+template <int Dimensions, typename InPtr, typename OutPtr, typename T,
+          typename BinaryOperation>
+OutPtr joint_exclusive_scan(const group<Dimensions> &,
+                            InPtr first,
+                            InPtr last,
+                            OutPtr result,
+                            T init,
+                            BinaryOperation op) {
+  return std::exclusive_scan(first, last, result, init, op);
+}
+
+
+/// Compute the exclusive scan of a range
+template <int Dimensions, typename InPtr, typename OutPtr,
+          typename BinaryOperation>
+OutPtr joint_exclusive_scan(const group<Dimensions> &g,
+                            InPtr first,
+                            InPtr last,
+                            OutPtr result,
+                            BinaryOperation op) {
+  using T = typename std::iterator_traits<InPtr>::value_type;
+  return joint_exclusive_scan(g, first, last, result,
+                              detail::known_identity<BinaryOperation, T>(),
+                              op);
+}
+
+
+/// Compute the inclusive scan of a range
+template <int Dimensions, typename InPtr, typename OutPtr,
+          typename BinaryOperation>
+OutPtr joint_inclusive_scan(const group<Dimensions> &,
+                            InPtr first,
+                            InPtr last,
+                            OutPtr result,
+                            BinaryOperation op) {
+  return std::inclusive_scan(first, last, result, op);
+}
+
+
+/// Compute the inclusive scan of a range with an initial value
+template <int Dimensions, typename InPtr, typename OutPtr,
+          typename BinaryOperation, typename T>
+OutPtr joint_inclusive_scan(const group<Dimensions> &,
+                            InPtr first,
+                            InPtr last,
+                            OutPtr result,
+                            BinaryOperation op,
+                            T init) {
+  return std::inclusive_scan(first, last, result, op, init);
+}
+
+
+/// Test whether a predicate is true for any element of a range
+template <int Dimensions, typename Ptr, typename Predicate>
+bool joint_any_of(const group<Dimensions> &,
+                  Ptr first,
+                  Ptr last,
+                  Predicate pred) {
+  return std::any_of(first, last, pred);
+}
+
+
+/// Test whether a predicate is true for all the elements of a range
+template <int Dimensions, typename Ptr, typename Predicate>
+bool joint_all_of(const group<Dimensions> &,
+                  Ptr first,
+                  Ptr last,
+                  Predicate pred) {
+  return std::all_of(first, last, pred);
+}
+
+
+/// Test whether a predicate is false for all the elements of a range
+template <int Dimensions, typename Ptr, typename Predicate>
+bool joint_none_of(const group<Dimensions> &,
+                   Ptr first,
+                   Ptr last,
+                   Predicate pred) {
+  return std::none_of(first, last, pred);
+}
+
+/// @} End the parallelism Doxygen group
+
+}
+
+/*
+    # Some Emacs stuff:
+    ### Local Variables:
+    ### ispell-local-dictionary: "american"
+    ### eval: (flyspell-prog-mode)
+    ### End:
+*/
+
+#endif // TRISYCL_SYCL_GROUP_ALGORITHM_HPP
@@ -9,8 +9,10 @@
     License. See LICENSE.TXT for details.
 */
 
+#include <algorithm>
 #include <concepts>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -23,11 +25,13 @@
 #include "triSYCL/command_group/detail/task.hpp"
 #include "triSYCL/detail/instantiate_kernel.hpp"
 #include "triSYCL/detail/unimplemented.hpp"
+#include "triSYCL/event.hpp"
 #include "triSYCL/exception.hpp"
 #include "triSYCL/kernel.hpp"
 #include "triSYCL/opencl_types.hpp"
 #include "triSYCL/parallelism.hpp"
 #include "triSYCL/queue/detail/queue.hpp"
+#include "triSYCL/usm/detail/usm_pool.hpp"
 
 namespace trisycl {
 
@@ -85,9 +89,11 @@ public:
   template <typename DataType,
             int Dimensions,
             access::mode Mode,
-            access::target Target = access::target::global_buffer>
-  void set_arg(int arg_index,
-               accessor<DataType, Dimensions, Mode, Target> && acc_obj) {
+            access::target Target = access::target::global_buffer,
+            typename Layout = std::layout_right>
+  void set_arg(
+      int arg_index,
+      accessor<DataType, Dimensions, Mode, Target, Layout> && acc_obj) {
     /* Think about setting the kernel argument before actually calling
        the kernel.
 
@@ -211,6 +217,75 @@ private:
     }));
   }
 
+  /** Schedule a host command working directly on unified shared memory
+
+      The USM is host-backed, so even on a non-host queue there is no
+      need for a device kernel to move the data around.
+  */
+  template <typename Command>
+  void schedule_usm_command(Command c) {
+    task->schedule(detail::trace_kernel<Command>(std::move(c)));
+  }
+
+public:
+
+  /** Make this command group wait for the command behind an event
+
+      This is the way to express dependencies between command groups
+      working on unified shared memory through kernels, since the
+      runtime cannot see the pointers captured by a kernel.
+  */
+  void depends_on(event e) {
+    task->add_dependency(e.implementation->get_task());
+  }
+
+
+  /// Make this command group wait for the commands behind some events
+  void depends_on(const vector_class<event> &events) {
+    for (const auto &e : events)
+      depends_on(e);
+  }
+
+
+  /** Copy some bytes between unified shared memory allocations or
+      host memory
+
+      The dependencies are tracked from the pointers when they point
+      into some USM allocations.
+  */
+  void memcpy(void *dest, const void *src, std::size_t num_bytes) {
+    detail::usm_pool::instance()->add_to_task(task, src, false);
+    detail::usm_pool::instance()->add_to_task(task, dest, true);
+    schedule_usm_command([=] { std::memcpy(dest, src, num_bytes); });
+  }
+
+
+  /// Copy some objects between unified shared memory allocations
+  template <typename T>
+  void copy(const T *src, T *dest, std::size_t count) {
+    memcpy(dest, src, count * sizeof(T));
+  }
+
+
+  /** Set some bytes of a unified shared memory allocation or host
+      memory to a value */
+  void memset(void *ptr, int value, std::size_t num_bytes) {
+    detail::usm_pool::instance()->add_to_task(task, ptr, true);
+    schedule_usm_command([=] { std::memset(ptr, value, num_bytes); });
+  }
+
+
+  /** Fill a unified shared memory allocation or host memory with
+      some copies of a pattern */
+  template <typename T>
+  void fill(void *ptr, const T &pattern, std::size_t count) {
+    detail::usm_pool::instance()->add_to_task(task, ptr, true);
+    schedule_usm_command([=] {
+      std::fill_n(static_cast<T *>(ptr), count, pattern);
+    });
+  }
+
+
 public:
 
   /** Kernel invocation method of a kernel defined as a lambda or
@@ -262,14 +337,71 @@ public:
   // Do not land here if we are using the sycl::kernel API
   requires (!std::derived_from<ParallelForFunctor, kernel>)
   void parallel_for(const range<Dims>& global_size, ParallelForFunctor f) {
+#if !defined(TRISYCL_USE_OPENCL_ND_RANGE)
+    if (task->recording) {
+      // Keep a sliceable version of the kernel for the kernel fusion
+      task->recorded_range.clear();
+      for (int d = 0; d < Dims; ++d)
+        task->recorded_range.push_back(global_size[d]);
+      task->recorded_slice = [=] (std::size_t begin, std::size_t end) mutable {
+        detail::parallel_for_slice(global_size, f, begin, end);
+      };
+    }
+#endif
     if constexpr (detail::use_native_work_item) {
       // Use a normal parallel for
       schedule_parallel_for_kernel<KernelName>(
           [=] { detail::parallel_for(global_size, f); }, global_size);
-    } else
+    } else {
+      if constexpr (Dims > 1)
+        if (task->iterate_first_dimension_innermost()) {
+          // Iterate in the memory order of mostly column-major data
+          schedule_kernel<KernelName>([=] {
+              detail::parallel_for_first_dimension_innermost(global_size, f);
+            });
+          return;
+        }
       // Launch a single-task kernel containing the loop nests
       schedule_kernel<KernelName>(
           [=] { detail::parallel_for(global_size, f); });
+    }
+  }
+
+  /** triSYCL extension launching a data parallel computation on an
+      iteration space known at compile time
+
+      On the host the kernel is run by a flat loop nest with constant
+      trip counts, so the innermost loop can be unrolled and
+      vectorized.
+
+      \param global_size is the static_range<> of the iteration space,
+      for example static_range<1024, 1024> {}
+
+      \tparam Extents are the sizes of the iteration space
+
+      \tparam KernelName is a class type that defines the name to be used
+      for the underlying kernel
+
+      \param f is the kernel functor to execute
+
+      \tparam ParallelForFunctor is the type of the kernel functor
+  */
+  template <typename KernelName = std::nullptr_t, std::size_t... Extents,
+            typename ParallelForFunctor>
+  requires (!std::derived_from<ParallelForFunctor, kernel>)
+  void parallel_for(static_range<Extents...> global_size,
+                    ParallelForFunctor f) {
+    if constexpr (detail::use_native_work_item)
+      // The native work-items only deal with a dynamic range<>
+      parallel_for<KernelName>(global_size.get_range(), f);
+    else if (task->recording || task->iterate_first_dimension_innermost())
+      /* The kernel fusion slices the kernels on a dynamic range<>,
+         which can also iterate in column-major order */
+      parallel_for<KernelName>(global_size.get_range(), f);
+    else
+      // Launch a single-task kernel containing the flat loop nest
+      schedule_kernel<KernelName>(
+          [=] { detail::parallel_for(global_size, f); });
   }
 
   /** SYCL parallel_for launches a data parallel computation with
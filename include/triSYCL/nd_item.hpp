@@ -12,11 +12,14 @@
 #include <cstddef>
 
 #include "triSYCL/access.hpp"
+#include "triSYCL/address_space.hpp"
+#include "triSYCL/device_event.hpp"
 #include "triSYCL/detail/linear_id.hpp"
 #include "triSYCL/detail/unimplemented.hpp"
 #include "triSYCL/id.hpp"
 #include "triSYCL/item.hpp"
 #include "triSYCL/nd_range.hpp"
+#include "triSYCL/parallelism/detail/group_scratch.hpp"
 #include "triSYCL/range.hpp"
 
 namespace trisycl {
@@ -39,6 +42,23 @@ private:
      ND_range */
   id<Dimensions> local_index;
   nd_range<Dimensions> ND_range;
+  /* The memory shared by the work-items of the work-group to implement
+     the group algorithms, if they are executed by cooperating threads */
+  detail::group_scratch *scratch = nullptr;
+
+  /** Whether the work-items of a work-group are executed concurrently
+      without any barrier to synchronize them, so that the asynchronous
+      work-group copies cannot be implemented
+
+      This is a template to be evaluated only when these copies are
+      used. */
+  template <typename... T>
+  static constexpr bool unsynchronized_work_items =
+#if (defined(_OPENMP) && defined(TRISYCL_NO_BARRIER)) || defined(TRISYCL_TBB)
+    ((sizeof(T *) > 0) && ...);
+#else
+    false;
+#endif
 
 public:
 
@@ -212,6 +232,92 @@ public:
   }
 
 
+  /** Asynchronously copy some elements from the global memory to the
+      local memory of the work-group
+
+      As in OpenCL, all the work-items of the work-group have to
+      encounter this function with the same arguments. On the host the
+      copy is done in bulk by the first work-item of the work-group
+      only.
+
+      \param[in] src_stride is the stride between the elements in the
+      global memory
+  */
+  template <typename T>
+  device_event
+  async_work_group_copy(multi_ptr<T *, access::address_space::local_space> dest,
+                        multi_ptr<T *, access::address_space::global_space> src,
+                        size_t num_elements,
+                        size_t src_stride = 1) const {
+    static_assert(!unsynchronized_work_items<T>,
+                  "The asynchronous work-group copies require barriers "
+                  "between the work-items, which are not available with "
+                  "TRISYCL_NO_BARRIER or TRISYCL_TBB");
+    if (get_local_linear_id() == 0)
+      detail::work_group_copy<T>(dest, src, num_elements, 1, src_stride);
+    return {};
+  }
+
+
+  /** Asynchronously copy some elements from the local memory of the
+      work-group to the global memory
+
+      As in OpenCL, all the work-items of the work-group have to
+      encounter this function with the same arguments. On the host the
+      copy is done in bulk by the last work-item of the work-group
+      only, so that in a sequential execution the local memory has
+      been produced by all the work-items.
+
+      \param[in] dest_stride is the stride between the elements in the
+      global memory
+  */
+  template <typename T>
+  device_event
+  async_work_group_copy(multi_ptr<T *, access::address_space::global_space> dest,
+                        multi_ptr<T *, access::address_space::local_space> src,
+                        size_t num_elements,
+                        size_t dest_stride = 1) const {
+    static_assert(!unsynchronized_work_items<T>,
+                  "The asynchronous work-group copies require barriers "
+                  "between the work-items, which are not available with "
+                  "TRISYCL_NO_BARRIER or TRISYCL_TBB");
+    if (get_local_linear_id() == get_local_range().size() - 1)
+      detail::work_group_copy<T>(dest, src, num_elements, dest_stride, 1);
+    return {};
+  }
+
+
+  /** Wait for some asynchronous copies to complete
+
+      This also synchronizes the work-items of the work-group so that
+      they all see the copied data, as required by OpenCL.
+  */
+  template <typename... EventTN>
+  void wait_for(EventTN... events) const {
+    static_assert(!unsynchronized_work_items<EventTN...>,
+                  "The asynchronous work-group copies require barriers "
+                  "between the work-items, which are not available with "
+                  "TRISYCL_NO_BARRIER or TRISYCL_TBB");
+    (events.wait(), ...);
+#if defined(_OPENMP) && !defined(TRISYCL_NO_BARRIER)
+    // Wait for the work-item doing the copy
+#pragma omp barrier
+#endif
+  }
+
+
+  /** Hint the processor to bring some global memory into the cache
+
+      The prefetch is issued only once by the work-group.
+  */
+  template <typename T>
+  void prefetch(multi_ptr<T *, access::address_space::global_space> p,
+                size_t num_elements) const {
+    if (get_local_linear_id() == 0)
+      detail::prefetch<T>(p, num_elements);
+  }
+
+
   // For the triSYCL implementation, need to set the local index
   void set_local(id<Dimensions> Index) { local_index = Index; }
 
@@ -219,6 +325,13 @@ public:
   // For the triSYCL implementation, need to set the global index
   void set_global(id<Dimensions> Index) { global_index = Index; }
 
+  /* For the triSYCL implementation, need to set the memory shared by
+     the work-items for the group algorithms */
+  void set_group_scratch(detail::group_scratch *s) { scratch = s; }
+
+  // For the triSYCL implementation of the group algorithms
+  detail::group_scratch *get_group_scratch() const { return scratch; }
+
   // Comparison operators
   bool operator==(const nd_item<Dimensions> &nd_itemB) const {
     return (ND_range == nd_itemB.ND_range &&
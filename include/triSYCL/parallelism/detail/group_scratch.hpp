@@ -0,0 +1,112 @@
+#ifndef TRISYCL_SYCL_PARALLELISM_DETAIL_GROUP_SCRATCH_HPP
+#define TRISYCL_SYCL_PARALLELISM_DETAIL_GROUP_SCRATCH_HPP
+
+/** \file The work-group shared memory used by the group algorithms
+
+    Ronan at Keryell point FR
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace trisycl::detail {
+
+/** \addtogroup parallelism
+    @{
+*/
+
+/** Some memory shared by the work-items of a work-group executed by
+    OpenMP threads to exchange their values in the group algorithms
+
+    Each work-item publishes its value in its own slot and then a single
+    barrier makes all the values visible to all the work-items, which
+    compute the result by themselves.
+
+    There are 2 banks of slots used alternately by the successive group
+    algorithms, so that a work-item can publish a new value while some
+    slower work-items are still reading the values of the previous
+    group algorithm: they have to cross the barrier of the new group
+    algorithm before the bank is reused again.
+*/
+class group_scratch {
+
+public:
+
+  /// The biggest size of a value exchanged by a group algorithm
+  static constexpr std::size_t max_value_size = 64;
+
+  /// The storage of a value, aligned to avoid some false sharing
+  struct alignas(max_value_size) slot {
+    std::byte data[max_value_size];
+  };
+
+private:
+
+  /// The number of work-items in the work-group
+  std::size_t work_items;
+
+  /// The 2 banks of slots, one slot per work-item in each bank
+  std::vector<slot> slots;
+
+  /// Count the group algorithms executed by each work-item
+  std::vector<std::size_t> calls;
+
+public:
+
+  /// Create the scratch memory for a work-group
+  group_scratch(std::size_t work_items)
+    : work_items { work_items }
+    , slots(2*work_items)
+    , calls(work_items) {}
+
+
+  /// The number of work-items in the work-group
+  std::size_t size() const { return work_items; }
+
+
+  /** Publish the value of a work-item and wait for the values of all
+      the work-items of the work-group
+
+      \return the bank with the values of all the work-items
+  */
+  template <typename T>
+  const slot *exchange(std::size_t local_id, const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>
+                  && sizeof(T) <= max_value_size,
+                  "Group algorithms require small trivially copyable types");
+    auto bank = &slots[(calls[local_id]++ % 2)*work_items];
+    std::memcpy(bank[local_id].data, &value, sizeof(T));
+#if defined(_OPENMP) && !defined(TRISYCL_NO_BARRIER)
+#pragma omp barrier
+#endif
+    return bank;
+  }
+
+
+  /// Get the value published by a work-item in a bank
+  template <typename T>
+  static T value(const slot *bank, std::size_t local_id) {
+    T v;
+    std::memcpy(&v, bank[local_id].data, sizeof(T));
+    return v;
+  }
+};
+
+/// @} End the parallelism Doxygen group
+
+}
+
+/*
+    # Some Emacs stuff:
+    ### Local Variables:
+    ### ispell-local-dictionary: "american"
+    ### eval: (flyspell-prog-mode)
+    ### End:
+*/
+
+#endif // TRISYCL_SYCL_PARALLELISM_DETAIL_GROUP_SCRATCH_HPP
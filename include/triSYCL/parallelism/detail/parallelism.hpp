@@ -14,6 +14,7 @@
 */
 
 #include <cstddef>
+#include <type_traits>
 
 #include "triSYCL/group.hpp"
 #include "triSYCL/h_item.hpp"
@@ -21,7 +22,9 @@
 #include "triSYCL/item.hpp"
 #include "triSYCL/nd_item.hpp"
 #include "triSYCL/nd_range.hpp"
+#include "triSYCL/parallelism/detail/group_scratch.hpp"
 #include "triSYCL/range.hpp"
+#include "triSYCL/static_range.hpp"
 
 #if defined(TRISYCL_USE_OPENCL_ND_RANGE)
 #include "triSYCL/detail/SPIR/opencl_spir_helpers.hpp"
@@ -68,6 +71,92 @@ struct parallel_for_iterate {
   }
 };
 
+
+/** Hint the compiler that the next loop can be vectorized
+
+    The iterations of a parallel_for are independent work-items, so
+    the loop-carried dependencies assumed by the compiler can be
+    ignored.
+*/
+#if defined(_OPENMP)
+#define TRISYCL_VECTORIZE_LOOP _Pragma("omp simd")
+#elif defined(__clang__)
+#define TRISYCL_VECTORIZE_LOOP \
+  _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define TRISYCL_VECTORIZE_LOOP _Pragma("GCC ivdep")
+#else
+#define TRISYCL_VECTORIZE_LOOP
+#endif
+
+
+/** A recursive multi-dimensional iterator variant with a vectorizable
+    innermost loop
+
+    The outer dimensions are iterated as with parallel_for_iterate but
+    the innermost loop gives to f a fresh copy of the index whose last
+    component is the induction variable, instead of storing it through
+    the index reference. So the outer components are visibly loop
+    invariant and an element-wise kernel can be vectorized.
+
+    Since the index reference is not updated by the innermost loop, f
+    has to use the index it receives.
+*/
+template <std::size_t level,
+          typename Range,
+          typename ParallelForFunctor,
+          typename Id>
+struct parallel_for_vector_iterate {
+  parallel_for_vector_iterate(Range r, ParallelForFunctor &f, Id &index) {
+    constexpr std::size_t dimension = Range::rank() - level;
+    if constexpr (level == 0)
+      // Nothing to iterate on, such as in a 1D parallel_for_slice
+      f(index);
+    else if constexpr (level == 1) {
+      const Id outer = index;
+      const std::size_t _sycl_end = r[dimension];
+      TRISYCL_VECTORIZE_LOOP
+      for (std::size_t _sycl_index = 0;
+           _sycl_index < _sycl_end;
+           _sycl_index++) {
+        Id inner = outer;
+        inner[dimension] = _sycl_index;
+        f(inner);
+      }
+    } else
+      for (std::size_t _sycl_index = 0,
+             _sycl_end = r[dimension];
+           _sycl_index < _sycl_end;
+           _sycl_index++) {
+        // Set the current value of the index for this dimension
+        index[dimension] = _sycl_index;
+        // Iterate further on lower dimensions
+        parallel_for_vector_iterate<level - 1,
+                                    Range,
+                                    ParallelForFunctor,
+                                    Id> { r, f, index };
+      }
+  }
+};
+
+
+/** The iterator used by the parallel_for on a range<>
+
+    When TRISYCL_VECTORIZE_INNERMOST is defined, the innermost
+    dimension is run as a vectorizable loop
+*/
+template <std::size_t level,
+          typename Range,
+          typename ParallelForFunctor,
+          typename Id>
+using parallel_for_range_iterate =
+#ifdef TRISYCL_VECTORIZE_INNERMOST
+  parallel_for_vector_iterate<level, Range, ParallelForFunctor, Id>;
+#else
+  parallel_for_iterate<level, Range, ParallelForFunctor, Id>;
+#endif
+
+
 #ifdef _OPENMP
 /** A top-level recursive multi-dimensional iterator variant using OpenMP
 
@@ -92,6 +181,19 @@ struct parallel_OpenMP_for_iterate {
          "collapse" could be useful for small iteration space, but it
          would need some template specialization to have real contiguous
          loop nests */
+#ifdef TRISYCL_VECTORIZE_INNERMOST
+      if constexpr (level == 1) {
+        // The top-level loop is also the innermost one
+#pragma omp for simd
+        for (std::size_t _sycl_index = 0;
+             _sycl_index < _sycl_end;
+             _sycl_index++) {
+          Id inner;
+          inner[0] = _sycl_index;
+          f(inner);
+        }
+      } else
+#endif
 #pragma omp for
       for (std::size_t _sycl_index = 0;
            _sycl_index < _sycl_end;
@@ -99,10 +201,10 @@ struct parallel_OpenMP_for_iterate {
         // Set the current value of the index for this dimension
         index[r.rank() - level] = _sycl_index;
         // Iterate further on lower dimensions
-        parallel_for_iterate<level - 1,
-                             Range,
-                             ParallelForFunctor,
-                             Id> { r, f, index };
+        parallel_for_range_iterate<level - 1,
+                                   Range,
+                                   ParallelForFunctor,
+                                   Id> { r, f, index };
       }
     }
   }
@@ -138,10 +240,10 @@ void parallel_for(range<Dimensions> r,
 #else
   // In a sequential execution there is only one index processed at a time
   id<Dimensions> index;
-  parallel_for_iterate<Dimensions,
-                       range<Dimensions>,
-                       ParallelForFunctor,
-                       id<Dimensions>> { r, f, index };
+  parallel_for_range_iterate<Dimensions,
+                             range<Dimensions>,
+                             ParallelForFunctor,
+                             id<Dimensions>> { r, f, index };
 #endif
 }
 
@@ -170,10 +272,10 @@ void parallel_for(range<Dimensions> r,
 #else
   // In a sequential execution there is only one index processed at a time
   id<Dimensions> index;
-  parallel_for_iterate<Dimensions,
-                       range<Dimensions>,
-                       decltype(reconstruct_item),
-                       id<Dimensions>> { r, reconstruct_item, index };
+  parallel_for_range_iterate<Dimensions,
+                             range<Dimensions>,
+                             decltype(reconstruct_item),
+                             id<Dimensions>> { r, reconstruct_item, index };
 #endif
 }
 
@@ -218,6 +320,141 @@ template <int Dimensions = 1, typename ParallelForFunctor>
 void parallel_for(range<Dimensions> r, ParallelForFunctor f) {
   parallel_for(r,f, capture_arg_v(&ParallelForFunctor::operator()));
 }
+
+
+/** Execute only a slice of a parallel_for on a range<>
+
+    Only the indices in [begin, end) of the outermost dimension are
+    iterated on, the other dimensions being fully iterated. This
+    allows to interleave the execution of several kernels by blocks,
+    as done by the kernel fusion.
+*/
+template <int Dimensions, typename ParallelForFunctor>
+void parallel_for_slice(range<Dimensions> r,
+                        ParallelForFunctor &f,
+                        std::size_t begin,
+                        std::size_t end) {
+  using index_type = std::remove_cvref_t<
+    decltype(capture_arg_v(&ParallelForFunctor::operator()))>;
+  auto kernel = [&] (id<Dimensions> l) {
+    if constexpr (std::is_same_v<index_type, item<Dimensions>>)
+      // Call the user kernel with the item<> instead of the id<>
+      f(item<Dimensions> { r, l });
+    else
+      f(l);
+  };
+  id<Dimensions> index;
+  for (std::size_t i = begin; i < end; ++i) {
+    index[0] = i;
+    // Iterate further on lower dimensions
+    parallel_for_range_iterate<Dimensions - 1,
+                               range<Dimensions>,
+                               decltype(kernel),
+                               id<Dimensions>> { r, kernel, index };
+  }
+}
+
+
+/** Implementation of a data parallel computation on a range<> with
+    the first dimension iterated in the innermost loop
+
+    This gives unit-stride accesses on column-major data, such as
+    buffers with a std::layout_left layout. The iteration space is
+    transposed to reuse the normal loop nests, the transposition of
+    the indices being resolved by the compiler.
+*/
+template <int Dimensions, typename ParallelForFunctor>
+void parallel_for_first_dimension_innermost(range<Dimensions> r,
+                                            ParallelForFunctor f) {
+  using index_type = std::remove_cvref_t<
+    decltype(capture_arg_v(&ParallelForFunctor::operator()))>;
+  range<Dimensions> transposed;
+  for (int d = 0; d < Dimensions; ++d)
+    transposed[d] = r[Dimensions - 1 - d];
+  auto kernel = [&] (id<Dimensions> t) {
+    id<Dimensions> l;
+    for (int d = 0; d < Dimensions; ++d)
+      l[d] = t[Dimensions - 1 - d];
+    if constexpr (std::is_same_v<index_type, item<Dimensions>>)
+      // Call the user kernel with the item<> instead of the id<>
+      f(item<Dimensions> { r, l });
+    else
+      f(l);
+  };
+  parallel_for(transposed, kernel, id<Dimensions> {});
+}
+
+
+/** A flat loop nest on a static_range<> ending up calling f
+
+    Each level adds a loop with a constant trip count and passes its
+    loop variable by value to the next level, so the id<> is only
+    built in the innermost loop from plain scalars. Unlike with
+    parallel_for_iterate there is no store through a mutable id<> and
+    the compiler can unroll and vectorize the innermost loop.
+
+    \param[in] indices are the loop variables of the outer levels
+*/
+template <typename StaticRange,
+          typename ParallelForFunctor,
+          typename... Indices>
+void static_parallel_for_iterate(ParallelForFunctor &f, Indices... indices) {
+  constexpr std::size_t level = sizeof...(Indices);
+  if constexpr (level == StaticRange::dimensions)
+    f(id<StaticRange::dimensions> { indices... });
+#ifdef TRISYCL_VECTORIZE_INNERMOST
+  else if constexpr (level + 1 == StaticRange::dimensions) {
+    /* Use a plain constant trip count and call the kernel directly
+       so that the compiler accepts the loop annotation */
+    constexpr auto n = StaticRange::get(level);
+    TRISYCL_VECTORIZE_LOOP
+    for (std::size_t i = 0; i < n; ++i)
+      f(id<StaticRange::dimensions> { indices..., i });
+  }
+#endif
+  else
+    for (std::size_t i = 0; i < StaticRange::get(level); ++i)
+      static_parallel_for_iterate<StaticRange>(f, indices..., i);
+}
+
+
+/** Implementation of a data parallel computation on a static_range<>
+    with an id or item kernel index
+
+    This implementation use OpenMP on the outermost loop if compiled
+    with the right flag.
+*/
+template <std::size_t... Extents, typename ParallelForFunctor>
+void parallel_for(static_range<Extents...> r, ParallelForFunctor f) {
+  using static_range_type = static_range<Extents...>;
+  constexpr auto dimensions = static_range_type::dimensions;
+  using index_type = std::remove_cvref_t<
+    decltype(capture_arg_v(&ParallelForFunctor::operator()))>;
+  range<dimensions> global_size = r;
+  auto kernel = [&] (id<dimensions> l) {
+    if constexpr (std::is_same_v<index_type, item<dimensions>>)
+      // Call the user kernel with the item<> instead of the id<>
+      f(item<dimensions> { global_size, l });
+    else
+      f(l);
+  };
+#ifdef _OPENMP
+#ifdef TRISYCL_VECTORIZE_INNERMOST
+  if constexpr (dimensions == 1) {
+    // The outermost loop is also the innermost one
+#pragma omp parallel for simd
+    for (std::size_t i = 0; i < static_range_type::get(0); ++i)
+      kernel(id<1> { i });
+  } else
+#endif
+  // Distribute the outermost loop on the OpenMP threads
+#pragma omp parallel for
+  for (std::size_t i = 0; i < static_range_type::get(0); ++i)
+    static_parallel_for_iterate<static_range_type>(kernel, i);
+#else
+  static_parallel_for_iterate<static_range_type>(kernel);
+#endif
+}
 #else
 template <int Dimensions = 1, typename ParallelForFunctor>
 void parallel_for(range<Dimensions> r, ParallelForFunctor f) {
@@ -265,11 +502,16 @@ void parallel_for_workgroup(nd_range<Dimensions> r,
 
 /** Implement the loop on the work-items inside a work-group
 
+    \param[in] scratch is the memory shared by the work-item threads
+    for the group algorithms of the nd_item<>, allocated once for all
+    the work-groups of the kernel, or nullptr
+
     \todo Better type the functor
 */
 template <int Dimensions, typename T_Item, typename ParallelForFunctor>
 void parallel_for_workitem(const group<Dimensions> &g,
-                           ParallelForFunctor f) {
+                           ParallelForFunctor f,
+                           group_scratch *scratch = nullptr) {
 #if defined(_OPENMP) && (!defined(TRISYCL_NO_BARRIER) && !defined(_MSC_VER))
   /* To implement barriers with OpenMP, one thread is created for each
      work-item in the group and thus an OpenMP barrier has the same effect
@@ -283,10 +525,16 @@ void parallel_for_workitem(const group<Dimensions> &g,
 
   auto tot = l_r.size();
 
+  auto share_scratch = [&] (T_Item &index) {
+    if constexpr (std::is_same_v<T_Item, nd_item<Dimensions>>)
+      index.set_group_scratch(scratch);
+  };
+
   if constexpr (Dimensions == 1) {
   #pragma omp parallel for collapse(1) schedule(static) num_threads(tot)
     for (size_t i = 0; i < l_r.get(0); ++i) {
       T_Item index{g.get_nd_range()};
+      share_scratch(index);
       index.set_local(i);
       index.set_global(index.get_local_id() + id_l_r * g.get_id());
       f(index);
@@ -296,6 +544,7 @@ void parallel_for_workitem(const group<Dimensions> &g,
     for (size_t i = 0; i < l_r.get(0); ++i) {
       for (size_t j = 0; j < l_r.get(1); ++j) {
         T_Item index{g.get_nd_range()};
+        share_scratch(index);
         index.set_local({i,j});
         index.set_global(index.get_local_id() + id_l_r * g.get_id());
         f(index);
@@ -307,6 +556,7 @@ void parallel_for_workitem(const group<Dimensions> &g,
       for (size_t j = 0; j < l_r.get(1); ++j)
         for (size_t k = 0; k < l_r.get(2); ++k) {
           T_Item index{g.get_nd_range()};
+          share_scratch(index);
           index.set_local({i,j,k});
           index.set_global(index.get_local_id() + id_l_r * g.get_id());
           f(index);
@@ -393,6 +643,16 @@ void parallel_for(nd_range<Dimensions> r,
 
 #ifdef _OPENMP
 
+#if !defined(TRISYCL_NO_BARRIER) && !defined(_MSC_VER)
+  /* The memory shared by the work-item threads for the group
+     algorithms, reused by all the work-groups since they are executed
+     one after the other */
+  group_scratch scratch { r.get_local_range().size() };
+  group_scratch *shared = &scratch;
+#else
+  group_scratch *shared = nullptr;
+#endif
+
   auto iterate_in_work_group = [&] (id<Dimensions> g) {
     //group.display();
 
@@ -400,7 +660,7 @@ void parallel_for(nd_range<Dimensions> r,
     trisycl::group<Dimensions> wg {g, r};
     parallel_for_workitem<Dimensions,
                           nd_item<Dimensions>,
-                          decltype(f)>(wg, f);
+                          decltype(f)>(wg, f, shared);
   };
 
 #else
@@ -20,6 +20,7 @@
 #include "triSYCL/nd_item.hpp"
 #include "triSYCL/nd_range.hpp"
 #include "triSYCL/range.hpp"
+#include "triSYCL/static_range.hpp"
 
 #include <tbb/blocked_range2d.h>
 #include <tbb/blocked_range3d.h>
@@ -110,6 +111,30 @@ void parallel_for(range<Dimensions> r, ParallelForFunctor f)
   parallel_for(r, f, arg_t{});
 }
 
+/** Implementation of a data parallel computation on a range<> with
+    the first dimension iterated in the innermost loop
+
+    TBB chooses its own blocking of the iteration space, so just use
+    the normal range<>
+*/
+template <int Dimensions, typename ParallelForFunctor>
+void parallel_for_first_dimension_innermost(range<Dimensions> r,
+                                            ParallelForFunctor f)
+{
+  parallel_for(r, f);
+}
+
+/** Implementation of a data parallel computation on a static_range<>
+
+    TBB splits the iteration space by itself, so just use the dynamic
+    range<>
+*/
+template <std::size_t... Extents, typename ParallelForFunctor>
+void parallel_for(static_range<Extents...> r, ParallelForFunctor f)
+{
+  parallel_for(r.get_range(), f);
+}
+
 /// Implementation of parallel_for with a range<> and an offset
 template <int Dimensions = 1, typename ParallelForFunctor>
 void parallel_for_global_offset(range<Dimensions> global_size,
@@ -22,6 +22,7 @@
 #include "triSYCL/detail/property.hpp"
 #include "triSYCL/device.hpp"
 #include "triSYCL/device_selector.hpp"
+#include "triSYCL/event.hpp"
 #include "triSYCL/exception.hpp"
 #include "triSYCL/handler.hpp"
 #include "triSYCL/info/param_traits.hpp"
@@ -319,8 +320,19 @@ public:
   template <typename Handler_Functor>
   event submit(Handler_Functor cgf) {
     handler command_group_handler { implementation };
+    auto &t = command_group_handler.task;
+    /* Use the same recorder for all the command group even if the
+       recording is stopped concurrently by another thread */
+    auto recorder = implementation->get_recorder();
+    t->recording = static_cast<bool>(recorder);
     cgf(command_group_handler);
-    return {};
+    if (t->recording)
+      // Give the command group to the command graph being recorded
+      recorder(t);
+    // Without any scheduled command there is nothing to wait for
+    else if (!t->scheduled)
+      return {};
+    return { std::make_shared<detail::task_event>(t) };
   }
 
 
@@ -340,6 +352,104 @@ public:
     return submit(cgf);
   }
 
+  /** \name Shortcuts for the unified shared memory
+
+      Each of them submits a command group with just one command
+      depending on some optional events.
+      @{
+  */
+
+  /// Copy some bytes between unified shared memory allocations
+  event memcpy(void *dest, const void *src, std::size_t num_bytes,
+               const vector_class<event> &dep_events = {}) {
+    return submit([&](handler &cgh) {
+      cgh.depends_on(dep_events);
+      cgh.memcpy(dest, src, num_bytes);
+    });
+  }
+
+  event memcpy(void *dest, const void *src, std::size_t num_bytes,
+               event dep_event) {
+    return memcpy(dest, src, num_bytes, vector_class<event> { dep_event });
+  }
+
+
+  /// Copy some objects between unified shared memory allocations
+  template <typename T>
+  event copy(const T *src, T *dest, std::size_t count,
+             const vector_class<event> &dep_events = {}) {
+    return memcpy(dest, src, count * sizeof(T), dep_events);
+  }
+
+
+  /// Set some bytes of a unified shared memory allocation to a value
+  event memset(void *ptr, int value, std::size_t num_bytes,
+               const vector_class<event> &dep_events = {}) {
+    return submit([&](handler &cgh) {
+      cgh.depends_on(dep_events);
+      cgh.memset(ptr, value, num_bytes);
+    });
+  }
+
+  event memset(void *ptr, int value, std::size_t num_bytes,
+               event dep_event) {
+    return memset(ptr, value, num_bytes, vector_class<event> { dep_event });
+  }
+
+
+  /// Fill a unified shared memory allocation with copies of a pattern
+  template <typename T>
+  event fill(void *ptr, const T &pattern, std::size_t count,
+             const vector_class<event> &dep_events = {}) {
+    return submit([&](handler &cgh) {
+      cgh.depends_on(dep_events);
+      cgh.fill(ptr, pattern, count);
+    });
+  }
+
+  template <typename T>
+  event fill(void *ptr, const T &pattern, std::size_t count,
+             event dep_event) {
+    return fill(ptr, pattern, count, vector_class<event> { dep_event });
+  }
+
+
+  /// Submit a single_task kernel working on unified shared memory
+  template <typename KernelName = std::nullptr_t, typename KernelType>
+  event single_task(KernelType k,
+                    const vector_class<event> &dep_events = {}) {
+    return submit([&](handler &cgh) {
+      cgh.depends_on(dep_events);
+      cgh.single_task<KernelName>(k);
+    });
+  }
+
+  template <typename KernelName = std::nullptr_t, typename KernelType>
+  event single_task(KernelType k, event dep_event) {
+    return single_task<KernelName>(k, vector_class<event> { dep_event });
+  }
+
+
+  /// Submit a parallel_for kernel working on unified shared memory
+  template <typename KernelName = std::nullptr_t, int Dims,
+            typename ParallelForFunctor>
+  event parallel_for(const range<Dims> &r, ParallelForFunctor f,
+                     const vector_class<event> &dep_events = {}) {
+    return submit([&](handler &cgh) {
+      cgh.depends_on(dep_events);
+      cgh.parallel_for<KernelName>(r, f);
+    });
+  }
+
+  template <typename KernelName = std::nullptr_t, int Dims,
+            typename ParallelForFunctor>
+  event parallel_for(const range<Dims> &r, ParallelForFunctor f,
+                     event dep_event) {
+    return parallel_for<KernelName>(r, f, vector_class<event> { dep_event });
+  }
+
+  /// @}
+
   /** Check if the queue was constructed with the specified
       property.
   */
@@ -11,6 +11,8 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <memory>
 #include <mutex>
 
 #ifdef TRISYCL_OPENCL
@@ -20,9 +22,12 @@
 #include "triSYCL/context.hpp"
 #include "triSYCL/device.hpp"
 #include "triSYCL/detail/debug.hpp"
+#include "triSYCL/exception.hpp"
 
 namespace trisycl::detail {
 
+struct task;
+
 /** Some implementation details about the SYCL queue
  */
 struct queue : detail::debug<detail::queue> {
@@ -34,13 +39,83 @@ struct queue : detail::debug<detail::queue> {
   /// To protect the access to the condition variable
   std::mutex finished_mutex;
 
+  /// The type of a recorder of the command groups submitted to the queue
+  using recorder_type =
+    std::function<void(const std::shared_ptr<detail::task> &)>;
+
+private:
+
+  /** When set, the command groups submitted to this queue are given
+      to this recorder of a command graph or of a kernel fusion instead
+      of being executed */
+  recorder_type recorder;
+
+  /** When set, execute the command groups deferred by a kernel fusion
+      on this queue */
+  std::function<void(void)> flusher;
+
+  /** To protect the recorder and the flusher from a concurrent
+      submission or wait on another thread */
+  std::mutex recorder_mutex;
+
+public:
 
   /// Initialize the queue with 0 running kernel
   queue() : running_kernels { 0 } {}
 
+
+  /** Start recording the command groups submitted to the queue
+
+      \param[in] r is called with each task submitted to the queue
+
+      \param[in] f is called to execute the deferred tasks, if any
+
+      \throw invalid_object_error if the queue is already recorded
+  */
+  void start_recording(recorder_type r, std::function<void(void)> f = {}) {
+    std::lock_guard<std::mutex> lg { recorder_mutex };
+    if (recorder)
+      throw invalid_object_error { "The queue is already being recorded" };
+    recorder = std::move(r);
+    flusher = std::move(f);
+  }
+
+
+  /// Stop recording the command groups submitted to the queue
+  void stop_recording() {
+    std::lock_guard<std::mutex> lg { recorder_mutex };
+    recorder = nullptr;
+    flusher = nullptr;
+  }
+
+
+  /** Get the current recorder, if any
+
+      This returns a copy so that it can be called without holding the
+      lock.
+  */
+  recorder_type get_recorder() {
+    std::lock_guard<std::mutex> lg { recorder_mutex };
+    return recorder;
+  }
+
+
+  /// Execute the command groups deferred by a kernel fusion, if any
+  void flush_deferred() {
+    std::function<void(void)> f;
+    {
+      std::lock_guard<std::mutex> lg { recorder_mutex };
+      f = flusher;
+    }
+    if (f)
+      f();
+  }
+
+
   /// Wait for all kernel completion
   void wait_for_kernel_execution() {
     TRISYCL_DUMP_T("Queue waiting for kernel completion");
+    flush_deferred();
     std::unique_lock<std::mutex> ul { finished_mutex };
     finished.wait(ul, [&] {
         // When there is no kernel running in this queue, we are ready to go
@@ -0,0 +1,95 @@
+#ifndef TRISYCL_SYCL_STATIC_RANGE_HPP
+#define TRISYCL_SYCL_STATIC_RANGE_HPP
+
+/** \file A triSYCL extension range<> with extents known at compile time
+
+    Ronan at Keryell point FR
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "triSYCL/range.hpp"
+
+namespace trisycl {
+
+/** \addtogroup parallelism Expressing parallelism through kernels
+    @{
+*/
+
+/** A range with all its extents known at compile time
+
+    When given to handler::parallel_for() instead of a range<>, the
+    iteration space is executed by a flat loop nest where each loop
+    has a constant trip count and the index is built by value from the
+    loop variables, so the compiler can unroll and vectorize the
+    innermost loop for kernels with a fixed problem size.
+
+    For example static_range<1024, 1024> {} iterates on the same space
+    as range<2> { 1024, 1024 }.
+
+    \tparam Extents are the sizes in each dimension, the last one
+    being the contiguous one
+*/
+template <std::size_t... Extents>
+  /* Use a constraint rather than a static_assert so that a
+     list-initialization like { N, M } given to an overloaded
+     parallel_for does not try to deduce an empty static_range */
+  requires (sizeof...(Extents) > 0)
+struct static_range {
+  /// The number of dimensions of the range
+  static constexpr int dimensions = sizeof...(Extents);
+
+  /// The extents of the range
+  static constexpr std::array<std::size_t, dimensions> extents { Extents... };
+
+  /// The number of dimensions of the range
+  static auto constexpr rank() { return dimensions; }
+
+  /// Return the size in the given dimension
+  static constexpr std::size_t get(int dimension) {
+    return extents[dimension];
+  }
+
+  /// Return the number of elements in the range
+  static constexpr std::size_t size() { return (Extents * ...); }
+
+  /// Return the equivalent dynamic range<>
+  static range<dimensions> get_range() { return { Extents... }; }
+
+  /// Allow to use a static_range where a range<> is expected
+  operator range<dimensions>() const { return get_range(); }
+};
+
+/// @} End the parallelism Doxygen group
+
+namespace detail {
+
+/// A type trait to check if a type is a static_range or not
+template <typename T> struct is_static_range : std::false_type {};
+
+/// Return true if template instantiating match a static_range
+template <std::size_t... Extents>
+struct is_static_range<static_range<Extents...>> : std::true_type {};
+
+/// A variable to check if a type is a static_range or not
+template <typename T>
+constexpr auto is_static_range_v = is_static_range<T>::value;
+
+} // namespace detail
+
+} // namespace trisycl
+
+/*
+    # Some Emacs stuff:
+    ### Local Variables:
+    ### ispell-local-dictionary: "american"
+    ### eval: (flyspell-prog-mode)
+    ### End:
+*/
+
+#endif // TRISYCL_SYCL_STATIC_RANGE_HPP
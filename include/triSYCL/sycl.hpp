@@ -54,12 +54,14 @@
 #include "triSYCL/buffer.hpp"
 #include "triSYCL/context.hpp"
 #include "triSYCL/device.hpp"
+#include "triSYCL/device_event.hpp"
 #include "triSYCL/device_runtime.hpp"
 #include "triSYCL/device_selector.hpp"
 #include "triSYCL/error_handler.hpp"
 #include "triSYCL/event.hpp"
 #include "triSYCL/exception.hpp"
 #include "triSYCL/group.hpp"
+#include "triSYCL/group_algorithm.hpp"
 #include "triSYCL/half.hpp"
 #include "triSYCL/handler.hpp"
 #include "triSYCL/h_item.hpp"
@@ -77,9 +79,11 @@
 #include "triSYCL/program.hpp"
 #include "triSYCL/queue.hpp"
 #include "triSYCL/range.hpp"
+#include "triSYCL/static_range.hpp"
 #include "triSYCL/sycl_2_2/pipe.hpp"
 #include "triSYCL/sycl_2_2/pipe_reservation.hpp"
 #include "triSYCL/sycl_2_2/static_pipe.hpp"
+#include "triSYCL/usm.hpp"
 #include "triSYCL/vec.hpp"
 
 // Some includes at the end to break some dependencies
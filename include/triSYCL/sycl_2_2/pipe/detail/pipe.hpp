@@ -12,7 +12,6 @@
     License. See LICENSE.TXT for details.
 */
 
-#include <condition_variable>
 #include <cstddef>
 #include <mutex>
 #include <deque>
@@ -29,6 +28,10 @@
 #define BOOST_CB_DISABLE_DEBUG
 #endif
 #include <boost/circular_buffer.hpp>
+#include <boost/fiber/condition_variable.hpp>
+#include <boost/fiber/mutex.hpp>
+
+#include "triSYCL/detail/binary_log.hpp"
 
 namespace trisycl::detail::sycl_2_2 {
 
@@ -66,6 +69,11 @@ struct reserve_id {
 
     Use some mutable members so that the pipe object can be changed even
     when the accessors are captured in a lambda.
+
+    The synchronization uses the Boost.Fiber primitives, which work
+    both between std::thread and between fibers, so that a blocking
+    access from a fiber only suspends this fiber instead of blocking
+    all the fibers sharing the same thread.
 */
 template <typename T>
 class pipe : public detail::debug<pipe<T>> {
@@ -86,7 +94,7 @@ private:
 
       In case the object is capture in a lambda per copy, make it
       mutable. */
-  mutable std::mutex cb_mutex;
+  mutable boost::fibers::mutex cb_mutex;
 
   /// The queue of pending write reservations
   std::deque<reserve_id<value_type>> w_rid_q;
@@ -107,10 +115,10 @@ private:
   std::size_t read_reserved_frozen;
 
   /// To signal that a read has been successful
-  std::condition_variable read_done;
+  boost::fibers::condition_variable read_done;
 
   /// To signal that a write has been successful
-  std::condition_variable write_done;
+  boost::fibers::condition_variable write_done;
 
   /// To control the debug mode, disabled by default
   bool debug_mode = false;
@@ -145,10 +153,10 @@ private:
       example on FPGA).
    */
   std::size_t size() const {
-    TRISYCL_DUMP_T("size() cb.size() = " << cb.size()
-                   << " cb.end() = " << (void *)&*cb.end()
-                   << " reserved_for_reading() = " << reserved_for_reading()
-                   << " reserved_for_writing() = " << reserved_for_writing());
+    TRISYCL_BLOG(pipe, 3,
+                 "size() cb.size() = {} reserved_for_reading() = {} "
+                 "reserved_for_writing() = {}",
+                 cb.size(), reserved_for_reading(), reserved_for_writing());
     /* The actual number of available elements depends from the
        elements blocked by some reservations.
        This prevents a consumer to read into reserved area. */
@@ -165,8 +173,8 @@ private:
       write side (for example on FPGA).
   */
   bool empty() const {
-    TRISYCL_DUMP_T("empty() cb.size() = " << cb.size()
-                   << " size() = " << size());
+    TRISYCL_BLOG(pipe, 3, "empty() cb.size() = {} size() = {}", cb.size(),
+                 size());
     // It is empty when the size is zero, taking into account reservations
     return size() ==  0;
   }
@@ -189,21 +197,21 @@ public:
 
   /// The size() method used outside needs to lock the datastructure
   std::size_t size_with_lock() const {
-    std::lock_guard<std::mutex> lg { cb_mutex };
+    std::lock_guard<boost::fibers::mutex> lg { cb_mutex };
     return size();
   }
 
 
   /// The empty() method used outside needs to lock the datastructure
   bool empty_with_lock() const {
-    std::lock_guard<std::mutex> lg { cb_mutex };
+    std::lock_guard<boost::fibers::mutex> lg { cb_mutex };
     return empty();
   }
 
 
   // The full() method used outside needs to lock the datastructure
   bool full_with_lock() const {
-    std::lock_guard<std::mutex> lg { cb_mutex };
+    std::lock_guard<boost::fibers::mutex> lg { cb_mutex };
     return full();
   }
 
@@ -221,8 +229,8 @@ public:
   */
   bool write(const T &value, bool blocking = false) {
     // Lock the pipe to avoid being disturbed
-    std::unique_lock<std::mutex> ul { cb_mutex };
-    TRISYCL_DUMP_T("Write pipe full = " << full());
+    std::unique_lock<boost::fibers::mutex> ul { cb_mutex };
+    TRISYCL_BLOG(pipe, 2, "Write pipe {} full = {}", this, full());
 
     if (blocking)
       /* If in blocking mode, wait for the not full condition, that
@@ -253,8 +261,8 @@ public:
   */
   bool read(T &value, bool blocking = false) {
     // Lock the pipe to avoid being disturbed
-    std::unique_lock<std::mutex> ul { cb_mutex };
-    TRISYCL_DUMP_T("Read pipe empty = " << empty());
+    std::unique_lock<boost::fibers::mutex> ul { cb_mutex };
+    TRISYCL_BLOG(pipe, 2, "Read pipe {} empty = {}", this, empty());
 
     if (blocking)
       /* If in blocking mode, wait for the not empty condition, that
@@ -331,7 +339,7 @@ public:
                     rid_iterator &rid,
                     bool blocking = false)  {
     // Lock the pipe to avoid being disturbed
-    std::unique_lock<std::mutex> ul { cb_mutex };
+    std::unique_lock<boost::fibers::mutex> ul { cb_mutex };
 
     TRISYCL_DUMP_T("Before read reservation cb.size() = " << cb.size()
                    << " size() = " << size());
@@ -379,7 +387,7 @@ public:
                      rid_iterator &rid,
                      bool blocking = false)  {
     // Lock the pipe to avoid being disturbed
-    std::unique_lock<std::mutex> ul { cb_mutex };
+    std::unique_lock<boost::fibers::mutex> ul { cb_mutex };
 
     TRISYCL_DUMP_T("Before write reservation cb.size() = " << cb.size()
                    << " size() = " << size());
@@ -419,7 +427,7 @@ public:
   */
   void move_read_reservation_forward() {
     // Lock the pipe to avoid nuisance
-    std::unique_lock<std::mutex> lock { cb_mutex };
+    std::unique_lock<boost::fibers::mutex> lock { cb_mutex };
 
     for (;;) {
       if (r_rid_q.empty())
@@ -457,7 +465,7 @@ public:
   */
   void move_write_reservation_forward() {
     // Lock the pipe to avoid nuisance
-    std::lock_guard<std::mutex> lg { cb_mutex };
+    std::lock_guard<boost::fibers::mutex> lg { cb_mutex };
 
     for (;;) {
       if (w_rid_q.empty())
@@ -22,7 +22,8 @@ namespace trisycl::detail {
 template <typename T,
           int Dimensions,
           access::mode Mode,
-          access::target Target>
+          access::target Target,
+          typename Layout>
 class accessor;
 
 namespace sycl_2_2 {
@@ -0,0 +1,128 @@
+#ifndef TRISYCL_SYCL_USM_HPP
+#define TRISYCL_SYCL_USM_HPP
+
+/** \file The SYCL 2020 unified shared memory on the host device
+
+    All the kinds of USM allocation are backed by the host memory and
+    served by a pooled allocator. The dependencies between the commands
+    are tracked from the pointers for the \c memcpy, \c memset and \c
+    fill commands and from the events given to \c handler::depends_on
+    for the kernels.
+
+    Ronan at Keryell point FR
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <cstddef>
+
+#include "triSYCL/context.hpp"
+#include "triSYCL/device.hpp"
+#include "triSYCL/queue.hpp"
+#include "triSYCL/usm/detail/usm_pool.hpp"
+
+namespace trisycl {
+
+/** \addtogroup data Data access and storage in SYCL
+    @{
+*/
+
+/** Allocate some unified shared memory of a given kind
+
+    \return the allocated memory or \c nullptr on failure
+*/
+inline void *malloc(std::size_t num_bytes,
+                    const device &,
+                    const context &,
+                    usm::alloc kind) {
+  return detail::usm_pool::instance()->allocate(num_bytes, kind);
+}
+
+
+/// Allocate some unified shared memory of a given kind for a queue
+inline void *malloc(std::size_t num_bytes, const queue &q, usm::alloc kind) {
+  return malloc(num_bytes, q.get_device(), q.get_context(), kind);
+}
+
+
+/// Allocate some unified shared memory for some objects of type T
+template <typename T>
+T *malloc(std::size_t count, const queue &q, usm::alloc kind) {
+  return static_cast<T *>(malloc(count * sizeof(T), q, kind));
+}
+
+
+/// Allocate some device memory, which is host memory here
+inline void *malloc_device(std::size_t num_bytes, const queue &q) {
+  return malloc(num_bytes, q, usm::alloc::device);
+}
+
+
+/// Allocate some device memory for some objects of type T
+template <typename T>
+T *malloc_device(std::size_t count, const queue &q) {
+  return malloc<T>(count, q, usm::alloc::device);
+}
+
+
+/// Allocate some host memory accessible from the device
+inline void *malloc_host(std::size_t num_bytes, const queue &q) {
+  return malloc(num_bytes, q, usm::alloc::host);
+}
+
+
+/// Allocate some host memory for some objects of type T
+template <typename T>
+T *malloc_host(std::size_t count, const queue &q) {
+  return malloc<T>(count, q, usm::alloc::host);
+}
+
+
+/// Allocate some memory shared between the host and the device
+inline void *malloc_shared(std::size_t num_bytes, const queue &q) {
+  return malloc(num_bytes, q, usm::alloc::shared);
+}
+
+
+/// Allocate some shared memory for some objects of type T
+template <typename T>
+T *malloc_shared(std::size_t count, const queue &q) {
+  return malloc<T>(count, q, usm::alloc::shared);
+}
+
+
+/** Free some unified shared memory
+
+    The memory goes back to the pool for later allocations. Freeing \c
+    nullptr does nothing.
+*/
+inline void free(void *ptr, const context &) {
+  detail::usm_pool::instance()->deallocate(ptr);
+}
+
+
+/// Free some unified shared memory allocated for a queue
+inline void free(void *ptr, const queue &q) {
+  free(ptr, q.get_context());
+}
+
+
+/// Get the kind of unified shared memory a pointer points into
+inline usm::alloc get_pointer_type(const void *ptr, const context &) {
+  return detail::usm_pool::instance()->get_pointer_type(ptr);
+}
+
+/// @} End the data Doxygen group
+
+}
+
+/*
+    # Some Emacs stuff:
+    ### Local Variables:
+    ### ispell-local-dictionary: "american"
+    ### eval: (flyspell-prog-mode)
+    ### End:
+*/
+
+#endif // TRISYCL_SYCL_USM_HPP
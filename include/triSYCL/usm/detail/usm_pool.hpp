@@ -0,0 +1,288 @@
+#ifndef TRISYCL_SYCL_USM_DETAIL_USM_POOL_HPP
+#define TRISYCL_SYCL_USM_DETAIL_USM_POOL_HPP
+
+/** \file The pooled allocator and the allocation registry behind the
+    unified shared memory on the host device
+
+    Ronan at Keryell point FR
+
+    This file is distributed under the University of Illinois Open Source
+    License. See LICENSE.TXT for details.
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "triSYCL/command_group/detail/task.hpp"
+#include "triSYCL/detail/debug.hpp"
+#include "triSYCL/detail/singleton.hpp"
+
+namespace trisycl::usm {
+
+/** \addtogroup data Data access and storage in SYCL
+    @{
+*/
+
+/// The kind of a unified shared memory allocation
+enum class alloc {
+  host,
+  device,
+  shared,
+  unknown
+};
+
+/// @} End the data Doxygen group
+
+}
+
+namespace trisycl::detail {
+
+/** \addtogroup data Data access and storage in SYCL
+    @{
+*/
+
+/** Keep track of a live unified shared memory allocation
+
+    Since the memory is directly addressed by the kernels with
+    pointers, this plays for the USM the role \c buffer_base plays for
+    the buffers in the dependency graph.
+*/
+struct usm_allocation {
+  /// The size requested by the user in bytes
+  std::size_t size;
+
+  /// The size class in the pool, or \c usm_pool::large_class
+  std::size_t size_class;
+
+  /// The kind of allocation requested by the user
+  usm::alloc kind;
+
+  /// Track the latest task to produce this allocation
+  std::weak_ptr<detail::task> latest_producer;
+};
+
+
+/** A pooled allocator for the unified shared memory of the host device
+
+    Allocations are rounded up to power-of-2 size classes and the
+    freed blocks are kept in per-class free lists, so an iterative
+    code allocating and freeing temporary arrays does not go through
+    the system allocator on each iteration.
+
+    The pool also keeps a registry of the live allocations indexed by
+    their base address, to find from any pointer inside an allocation
+    the task which produces it.
+*/
+class usm_pool : public detail::singleton<usm_pool>,
+                 detail::debug<usm_pool> {
+
+public:
+
+  /// The alignment of all the allocations, at least a cache line
+  static constexpr std::size_t alignment = 64;
+
+  /// The smallest size class, in log2 of bytes
+  static constexpr std::size_t min_class_log2 = 6;
+
+  /// The biggest pooled size class, in log2 of bytes
+  static constexpr std::size_t max_class_log2 = 24;
+
+  /// Marker for the allocations too big to be pooled
+  static constexpr std::size_t large_class =
+    max_class_log2 - min_class_log2 + 1;
+
+private:
+
+  /// The free blocks for each size class
+  std::array<std::vector<void *>, large_class> free_lists;
+
+  /// The live allocations, indexed by their base address
+  std::map<const std::byte *, usm_allocation> allocations;
+
+  /// To protect the free lists and the registry
+  std::mutex m;
+
+
+  /// Compute the size class of a size in bytes
+  static std::size_t size_class_of(std::size_t size) {
+    std::size_t log2 = std::bit_width(std::max(size, std::size_t { 1 }) - 1);
+    if (log2 > max_class_log2)
+      return large_class;
+    return log2 <= min_class_log2 ? 0 : log2 - min_class_log2;
+  }
+
+
+  /// Compute the real size of the block behind an allocation
+  static std::size_t block_size(std::size_t size, std::size_t size_class) {
+    if (size_class == large_class)
+      // Round up to the alignment as required by std::aligned_alloc
+      return (size + alignment - 1) & ~(alignment - 1);
+    return std::size_t { 1 } << (size_class + min_class_log2);
+  }
+
+
+  /** Find the live allocation containing a pointer
+
+      The mutex is expected to be already locked.
+
+      \return an iterator on the allocation or \c allocations.end()
+  */
+  auto find(const void *ptr) {
+    auto p = static_cast<const std::byte *>(ptr);
+    // Find the first allocation starting after the pointer
+    auto i = allocations.upper_bound(p);
+    if (i == allocations.begin())
+      return allocations.end();
+    // So the candidate is the previous one
+    --i;
+    // Accept also the past-the-end pointer of an allocation
+    if (p <= i->first + i->second.size)
+      return i;
+    return allocations.end();
+  }
+
+public:
+
+  /** Allocate some memory from the pool
+
+      \param[in] size is the number of bytes to allocate
+
+      \param[in] kind is the kind of USM memory requested
+
+      \return the allocated memory or \c nullptr on failure or 0-byte
+      request, as with the SYCL 2020 \c malloc_* functions
+  */
+  void *allocate(std::size_t size, usm::alloc kind) {
+    if (size == 0)
+      return nullptr;
+    auto size_class = size_class_of(size);
+    void *p = nullptr;
+    std::lock_guard<std::mutex> lg { m };
+    if (size_class != large_class && !free_lists[size_class].empty()) {
+      // Recycle a block from the pool
+      p = free_lists[size_class].back();
+      free_lists[size_class].pop_back();
+    }
+    else {
+      p = std::aligned_alloc(alignment, block_size(size, size_class));
+      if (!p)
+        return nullptr;
+    }
+    allocations.emplace(static_cast<const std::byte *>(p),
+                        usm_allocation { size, size_class, kind, {} });
+    TRISYCL_DUMP_T("usm_pool::allocate " << size << " bytes at " << p);
+    return p;
+  }
+
+
+  /** Give back some memory to the pool
+
+      Freeing \c nullptr or an unknown pointer does nothing.
+  */
+  void deallocate(void *ptr) {
+    TRISYCL_DUMP_T("usm_pool::deallocate " << ptr);
+    std::lock_guard<std::mutex> lg { m };
+    auto i = allocations.find(static_cast<const std::byte *>(ptr));
+    if (i == allocations.end())
+      return;
+    auto size_class = i->second.size_class;
+    allocations.erase(i);
+    if (size_class == large_class)
+      std::free(ptr);
+    else
+      free_lists[size_class].push_back(ptr);
+  }
+
+
+  /// Get the kind of allocation a pointer points into
+  usm::alloc get_pointer_type(const void *ptr) {
+    std::lock_guard<std::mutex> lg { m };
+    auto i = find(ptr);
+    return i == allocations.end() ? usm::alloc::unknown : i->second.kind;
+  }
+
+
+  /** Get the base address of the allocation a pointer points into
+
+      \return the pointer itself if it is not inside a USM allocation
+  */
+  const void *get_base(const void *ptr) {
+    std::lock_guard<std::mutex> lg { m };
+    auto i = find(ptr);
+    return i == allocations.end() ? ptr : i->first;
+  }
+
+
+  /** Register a pointer used by a task
+
+      This is how the dependency graph is incrementally built for the
+      USM, in the same way as \c task::add_buffer does for the buffers.
+
+      A pointer outside of any USM allocation is ignored, since there
+      is no way to track its producers.
+  */
+  void add_to_task(const std::shared_ptr<detail::task> &t,
+                   const void *ptr,
+                   bool is_write_mode) {
+    if (t->recording) {
+      /* The command graph deals with the dependencies on replay, or
+         track() when the task is deferred by a kernel fusion */
+      t->recorded_pointers.emplace_back(ptr, is_write_mode);
+      return;
+    }
+    track(t, ptr, is_write_mode);
+  }
+
+
+  /// Add a pointer used by a task in the dependency graph
+  void track(const std::shared_ptr<detail::task> &t,
+             const void *ptr,
+             bool is_write_mode) {
+    std::shared_ptr<detail::task> latest_producer;
+    {
+      std::lock_guard<std::mutex> lg { m };
+      auto i = find(ptr);
+      if (i == allocations.end())
+        return;
+      auto &producer = i->second.latest_producer;
+      latest_producer = producer.lock();
+      if (is_write_mode)
+        /* Set this task as the latest producer of the allocation so
+           that another command may wait on this task */
+        producer = t;
+    }
+    t->add_dependency(latest_producer);
+  }
+
+
+  /// Give back the pooled memory to the system
+  ~usm_pool() {
+    for (auto &fl : free_lists)
+      for (auto p : fl)
+        std::free(p);
+  }
+
+};
+
+/// @} End the data Doxygen group
+
+}
+
+/*
+    # Some Emacs stuff:
+    ### Local Variables:
+    ### ispell-local-dictionary: "american"
+    ### eval: (flyspell-prog-mode)
+    ### End:
+*/
+
+#endif // TRISYCL_SYCL_USM_DETAIL_USM_POOL_HPP
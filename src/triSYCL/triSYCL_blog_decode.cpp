@@ -0,0 +1,43 @@
+/* Decode into text the binary log written by the triSYCL runtime
+
+   Usage: triSYCL_blog_decode [binary-log-file [text-output-file]]
+
+   By default the file trisycl.blog is decoded on the standard output.
+
+   Ronan at Keryell point FR
+
+   This file is distributed under the University of Illinois Open Source
+   License. See LICENSE.TXT for details.
+*/
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "triSYCL/detail/binary_log.hpp"
+
+int main(int argc, char* argv[]) {
+  if (argc > 3) {
+    std::cerr << "Usage: " << argv[0]
+              << " [binary-log-file [text-output-file]]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::ifstream in { argc > 1 ? argv[1] : "trisycl.blog", std::ios::binary };
+  if (!in) {
+    std::cerr << "Cannot open " << (argc > 1 ? argv[1] : "trisycl.blog")
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  try {
+    if (argc > 2) {
+      std::ofstream out { argv[2] };
+      trisycl::detail::binary_log::decode(in, out);
+    } else
+      trisycl::detail::binary_log::decode(in, std::cout);
+  } catch (const std::runtime_error& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
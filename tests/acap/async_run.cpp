@@ -0,0 +1,110 @@
+/* Pipeline some programs on an AIE device without waiting for them
+   from the host
+
+   RUN: %{execute}%s
+*/
+
+#include <sycl/sycl.hpp>
+
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/fiber/future.hpp>
+#include <boost/test/minimal.hpp>
+
+using namespace sycl::vendor::xilinx;
+
+using layout = acap::aie::layout::size<2, 1>;
+
+// The programs executed on each tile, in order
+std::vector<int> trace[layout::x_max + 1];
+std::mutex trace_protection;
+
+void record(int x, int program) {
+  std::lock_guard lock { trace_protection };
+  trace[x].push_back(program);
+}
+
+/* A latch released by the host to control the progress of the tile
+   programs deterministically. Use the fiber version to suspend only
+   the waiting fiber when the tile code runs on fibers */
+struct latch {
+  boost::fibers::promise<void> release;
+  boost::fibers::shared_future<void> released =
+    release.get_future().share();
+};
+
+/* The latches are owned by test_main() so that they are destroyed
+   while the fiber runtime is still alive */
+latch *first_latch;
+latch *third_latch;
+
+/// A program waiting for the host
+template <typename AIE, int X, int Y>
+struct first : acap::aie::tile<AIE, X, Y> {
+  void run() {
+    first_latch->released.wait();
+    record(X, 1);
+  }
+};
+
+/// A program failing on the last tile
+template <typename AIE, int X, int Y>
+struct second : acap::aie::tile<AIE, X, Y> {
+  void run() {
+    record(X, 2);
+    if (X == layout::x_max)
+      throw std::runtime_error { "Failing on purpose" };
+  }
+};
+
+/// Another program waiting for the host
+template <typename AIE, int X, int Y>
+struct third : acap::aie::tile<AIE, X, Y> {
+  void run() {
+    third_latch->released.wait();
+    record(X, 3);
+  }
+};
+
+int test_main(int argc, char *argv[]) {
+  latch for_first, for_third;
+  first_latch = &for_first;
+  third_latch = &for_third;
+  acap::aie::device<layout> d;
+  auto e1 = d.run_async<first>();
+  // The second program is queued behind the first one on each tile
+  auto e2 = d.queue().submit<second>();
+  // The host is free to do something else meanwhile
+  BOOST_CHECK(!e1.is_complete(0, 0));
+  BOOST_CHECK(!e2.is_complete(0, 0));
+  first_latch->release.set_value();
+  e2.wait(0, 0);
+  // The first program has completed on a tile before the second one
+  BOOST_CHECK(e1.is_complete(0, 0));
+  e1.wait(0, 0);
+  auto e3 = d.run_async<third>();
+  /* Waiting again for a tile already waited for does not wait for the
+     work launched later on the tile by another program */
+  e1.wait(0, 0);
+  BOOST_CHECK(e1.is_complete(0, 0));
+  BOOST_CHECK(!e3.is_complete(0, 0));
+  try {
+    e2.wait();
+    BOOST_ERROR("The exception of the second program is not reported");
+  } catch (std::runtime_error &) {
+  }
+  // The failure of the second program does not affect the first one
+  e1.wait();
+  third_latch->release.set_value();
+  e3.wait();
+  for (auto &t : trace)
+    BOOST_CHECK((t == std::vector { 1, 2, 3 }));
+  // The device can still be used synchronously
+  d.run<first>();
+  for (auto &t : trace)
+    BOOST_CHECK((t == std::vector { 1, 2, 3, 1 }));
+  return 0;
+}
@@ -0,0 +1,59 @@
+/* Measure the construction and the destruction time of the AIE device
+   emulation for various layouts
+
+   RUN: %{execute}%s
+*/
+
+#include <sycl/sycl.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <optional>
+
+#include <boost/test/minimal.hpp>
+
+// Use precise time measurement
+using clk = std::chrono::high_resolution_clock;
+
+using namespace sycl::vendor::xilinx;
+using namespace sycl::vendor::xilinx::acap::aie;
+
+// Number of device constructions and destructions to average on
+constexpr auto repetitions = 3;
+
+// Get the duration in seconds of some work as a double
+auto measure = [] (const auto& some_work) {
+  auto starting_point = clk::now();
+  some_work();
+  return std::chrono::duration<double> { clk::now() - starting_point }.count();
+};
+
+
+int test_main(int argc, char *argv[]) {
+  // Run on various sizes
+  auto sizes = boost::hana::make_tuple(layout::one_pe {},
+                                       layout::size<2,1> {},
+                                       layout::size<4,4> {},
+                                       layout::vc1902 {});
+  boost::hana::for_each(sizes, [&] (auto s) {
+    using d_t = acap::aie::device<decltype(s)>;
+    double setup = 0;
+    double teardown = 0;
+    for (int i = 0; i < repetitions; ++i) {
+      std::optional<d_t> d;
+      setup += measure([&] { d.emplace(); });
+      // Check the network is working
+      d->tile(0, 0).connect(d_t::csp::me_0, d_t::cmp::me_1);
+      d->tile(0, 0).out(0) << 42;
+      int receive;
+      d->tile(0, 0).in(1) >> receive;
+      BOOST_CHECK(receive == 42);
+      teardown += measure([&] { d.reset(); });
+    }
+    std::cout << "AIE device (" << d_t::geo::x_size << ',' << d_t::geo::y_size
+              << ") setup: " << setup/repetitions
+              << " s, teardown: " << teardown/repetitions << " s"
+              << std::endl;
+  });
+  return 0;
+}
@@ -0,0 +1,87 @@
+/* Stream some data through an AIE tile with double buffers filled and
+   drained by the DMAs while the tile computes
+
+   RUN: %{execute}%s
+*/
+
+#include <sycl/sycl.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include <boost/test/minimal.hpp>
+
+using namespace sycl::vendor::xilinx;
+using namespace sycl::vendor::xilinx::acap::aie;
+
+using d_t = acap::aie::device<layout::size<1, 1>>;
+
+using value_t = std::uint32_t;
+
+// The number of elements in each half of the double buffers
+auto constexpr block_size = 256;
+// The number of blocks going through the tile
+auto constexpr block_number = 40;
+
+template <typename AIE, int X, int Y>
+struct scale : acap::aie::tile<AIE, X, Y> {
+  using t = acap::aie::tile<AIE, X, Y>;
+  // Use locks 0 and 1 for the input and locks 2 and 3 for the output
+  double_buffer<value_t, block_size> in { 0 };
+  double_buffer<value_t, block_size> out { 2 };
+
+  void run() {
+    // Start filling both halves of the input
+    in.receive(*this, t::rx_dma(0));
+    in.receive(*this, t::rx_dma(0));
+    for (auto b = 0; b < block_number; ++b) {
+      // Compute on a half while the DMAs work on the other ones
+      in.consume(*this, [&](auto input) {
+        out.produce(*this, [&](auto output) {
+          for (std::size_t i = 0; i < input.size(); ++i)
+            output[i] = 3 * input[i];
+        });
+      });
+      out.send(*this, t::tx_dma(0));
+      if (b + 2 < block_number)
+        in.receive(*this, t::rx_dma(0));
+    }
+    t::tx_dma(0).wait();
+  }
+};
+
+int test_main(int argc, char *argv[]) {
+  d_t d;
+  d.tile(0, 0).connect(d_t::cass::s_south_range[0], d_t::cmp::dma_0);
+  d.tile(0, 0).connect(d_t::csp::dma_0, d_t::cass::m_south_range[0]);
+  d.shim(0).connect(d_t::sass::s_south_range[0], d_t::sass::m_north_range[0]);
+  d.shim(0).connect(d_t::sass::s_north_range[0], d_t::sass::m_south_range[0]);
+
+  std::vector<value_t> input(block_size * block_number);
+  std::iota(input.begin(), input.end(), 0);
+  std::vector<value_t> output(input.size());
+
+  // Some (future) FPGA kernels streaming the data to and from the AIE
+  sycl::queue q;
+  q.submit([&](auto& h) {
+    h.single_task([&] {
+      for (auto v : input)
+        d.shim(0).bli_out(0) << v;
+    });
+  });
+  q.submit([&](auto& h) {
+    h.single_task([&] {
+      for (auto& v : output)
+        v = d.shim(0).bli_in(0).read();
+    });
+  });
+
+  d.run<scale>();
+  q.wait();
+
+  for (std::size_t i = 0; i < input.size(); ++i)
+    BOOST_CHECK(output[i] == 3 * input[i]);
+  return 0;
+}
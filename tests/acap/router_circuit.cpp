@@ -6,6 +6,7 @@
 
 #include <sycl/sycl.hpp>
 
+#include <algorithm>
 #include <future>
 #include <iostream>
 
@@ -64,6 +65,26 @@ struct neighbor : acap::aie::tile<AIE, X, Y> {
 };
 
 
+// The values received by tile(1,0) on each of its 2 inputs
+int received[2][size];
+
+// Test a broadcast from tile(0,0) to the 2 inputs of tile(1,0)
+template <typename AIE, int X, int Y>
+struct broadcast : acap::aie::tile<AIE, X, Y> {
+  using t = acap::aie::tile<AIE, X, Y>;
+  void run() {
+    for (int i = 0; i < size; ++i) {
+      if constexpr (X == 0 && Y == 0)
+        t::out(1) << 10*i;
+      else if constexpr (X == 1 && Y == 0) {
+        t::in(0) >> received[0][i];
+        t::in(1) >> received[1][i];
+      }
+    }
+  }
+};
+
+
 int test_main(int argc, char *argv[]) {
 //boost::fibers::use_scheduling_algorithm< boost::fibers::algo::shared_work >();
   try {
@@ -131,10 +152,39 @@ int test_main(int argc, char *argv[]) {
     // Test neighbor core connection
     d.tile(0,0).connect(d_t::csp::me_1, d_t::cmp::east_0);
     d.tile(1,0).connect(d_t::csp::west_0, d_t::cmp::me_0);
+    // Jump over the routers between the tiles
+    d.compile_routes();
     std::cout << "From the device point of view" << std::endl;
     // From the device point of view
     d.run<neighbor>();
 
+    /* Rewire the circuit after its compilation into a broadcast, which
+       makes the compiled shortcut to tile(1,0) me_0 stale */
+    d.tile(1,0).connect(d_t::csp::west_0, d_t::cmp::me_1);
+    d.run<broadcast>();
+    for (int i = 0; i < size; ++i) {
+      BOOST_CHECK(received[0][i] == 10*i);
+      BOOST_CHECK(received[1][i] == 10*i);
+    }
+    // The broadcast is still done by the routing fiber once recompiled
+    d.compile_routes();
+    std::fill_n(&received[0][0], 2*size, -1);
+    d.run<broadcast>();
+    for (int i = 0; i < size; ++i) {
+      BOOST_CHECK(received[0][i] == 10*i);
+      BOOST_CHECK(received[1][i] == 10*i);
+    }
+
+    // An output driven by 2 inputs is a conflict detected by the compilation
+    d.tile(1,0).connect(d_t::csp::me_1, d_t::cmp::me_0);
+    bool conflict_detected = false;
+    try {
+      d.compile_routes();
+    } catch (sycl::runtime_error &) {
+      conflict_detected = true;
+    }
+    BOOST_CHECK(conflict_detected);
+
 /*    d.tile(0,0)
       .connect(geo::core_axi_stream_switch::slave_port_layout::me_0)
       .to(geo::core_axi_stream_switch::master_port_layout::east_0);
@@ -0,0 +1,71 @@
+/* Record the timeline of an AIE emulation into a Chrome trace file
+
+   RUN: %{execute}%s
+*/
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <string>
+
+#include <boost/test/minimal.hpp>
+
+using namespace sycl::vendor::xilinx;
+using namespace sycl::vendor::xilinx::acap::aie;
+
+using d_t = acap::aie::device<layout::size<1, 1>>;
+
+template <typename AIE, int X, int Y>
+struct loopback : acap::aie::tile<AIE, X, Y> {
+  using t = acap::aie::tile<AIE, X, Y>;
+  std::array<std::uint32_t, 64> in;
+  std::array<std::uint32_t, 64> out;
+
+  void run() {
+    std::iota(in.begin(), in.end(), 0);
+    // Receive into out once the lock 1 is free
+    t::rx_dma(0).receive(out, t::get_lock(1));
+    // Send in once the lock 0 says it is full
+    t::tx_dma(0).send(in, t::get_lock(0));
+    t::get_lock(0).release_with_value(true);
+    t::get_lock(1).acquire_with_value(true);
+    t::tx_dma(0).wait();
+  }
+};
+
+int test_main(int argc, char *argv[]) {
+  std::string file_name = "trace_test.json";
+  // Start recording before creating the device to trace its DMAs
+  trace::start(file_name);
+  {
+    d_t d;
+    // Loop the tile output back to its input
+    d.tile(0, 0).connect(d_t::csp::dma_0, d_t::cmp::dma_0);
+    d.run<loopback>();
+  }
+  trace::write();
+
+  std::ifstream f { file_name };
+  std::string json { std::istreambuf_iterator<char> { f }, {} };
+  auto contains = [&](const std::string& s) {
+    return json.find(s) != std::string::npos;
+  };
+  BOOST_CHECK(json.starts_with(R"j({"displayTimeUnit":"ns","traceEvents":[)j"));
+  BOOST_CHECK(json.ends_with("]}\n"));
+  BOOST_CHECK(std::ranges::count(json, '{') == std::ranges::count(json, '}'));
+  BOOST_CHECK(contains(R"j("args":{"name":"tile(0,0)"})j"));
+  BOOST_CHECK(contains(R"j("args":{"name":"core"})j"));
+  BOOST_CHECK(contains(R"j("args":{"name":"rx dma 0"})j"));
+  BOOST_CHECK(contains(R"j("args":{"name":"tx dma 0"})j"));
+  BOOST_CHECK(contains(R"j({"name":"tile program","cat":"core","ph":"X")j"));
+  BOOST_CHECK(contains(R"j({"name":"receive","cat":"dma","ph":"X")j"));
+  BOOST_CHECK(contains(R"j({"name":"send","cat":"dma","ph":"X")j"));
+  BOOST_CHECK(contains(R"j({"name":"lock release","cat":"lock","ph":"i")j"));
+  BOOST_CHECK(contains(R"j("args":{"words":64})j"));
+  return 0;
+}
@@ -0,0 +1,137 @@
+/* RUN: %{execute}%s
+
+   Check the emulation of the memory banks of the partitioned arrays
+   to estimate the initiation interval of the pipelined loops
+*/
+#define TRISYCL_XILINX_FPGA_BANK_STATISTICS 1
+
+#include <CL/sycl.hpp>
+
+#include <sstream>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cl::sycl;
+using namespace cl::sycl::vendor::xilinx;
+
+constexpr std::size_t banks = 4;
+constexpr std::size_t size = banks*banks;
+
+/** Sum the rows of a matrix, with each row read by a pipeline
+    iteration, to show the partitioning allowing an II of 1 */
+template <typename Array>
+int sum_rows(Array &a) {
+  int s = 0;
+  for (std::size_t i = 0; i < banks; ++i)
+    pipeline([&] {
+        for (std::size_t j = 0; j < banks; ++j)
+          s += a[i*banks + j];
+      });
+  return s;
+}
+
+
+/// Same with the columns
+template <typename Array>
+int sum_columns(Array &a) {
+  int s = 0;
+  for (std::size_t j = 0; j < banks; ++j)
+    pipeline([&] {
+        for (std::size_t i = 0; i < banks; ++i)
+          s += a[i*banks + j];
+      });
+  return s;
+}
+
+
+TEST_CASE("bank mapping", "[bank statistics]") {
+  using cyclic_array = partition_array<int, size, partition::cyclic<banks>>;
+  using block_array = partition_array<int, size, partition::block<banks>>;
+  STATIC_REQUIRE(cyclic_array::bank_number() == banks);
+  STATIC_REQUIRE(block_array::bank_number() == banks);
+  STATIC_REQUIRE(cyclic_array::bank(6) == 2);
+  STATIC_REQUIRE(block_array::bank(6) == 1);
+  STATIC_REQUIRE(partition_array<int, size>::bank_number() == 1);
+}
+
+
+TEST_CASE("bank conflicts", "[bank statistics]") {
+  partition_array<int, size, partition::cyclic<banks>> cyclic;
+  partition_array<int, size, partition::block<banks>> block;
+  partition_array<int, size> none;
+  partition_array<int, size, partition::complete<>> complete;
+  for (std::size_t i = 0; i < size; ++i)
+    cyclic[i] = block[i] = none[i] = complete[i] = i;
+  // The initialization is not in a pipeline region
+  REQUIRE(cyclic.stats->accesses == 0);
+
+  // A row is spread over all the banks of a cyclic partitioning
+  REQUIRE(sum_rows(cyclic) == 120);
+  REQUIRE(cyclic.stats->iterations == banks);
+  REQUIRE(cyclic.stats->accesses == size);
+  REQUIRE(cyclic.stats->conflict_iterations == 0);
+  REQUIRE(cyclic.stats->max_ii == 1);
+  REQUIRE(cyclic.stats->bank_accesses[0] == banks);
+
+  // But a column is in the same bank
+  REQUIRE(sum_columns(cyclic) == 120);
+  REQUIRE(cyclic.stats->conflict_iterations == banks);
+  REQUIRE(cyclic.stats->stall_cycles == banks);
+  REQUIRE(cyclic.stats->max_ii == 2);
+
+  // This is the opposite with a block partitioning
+  REQUIRE(sum_columns(block) == 120);
+  REQUIRE(block.stats->conflict_iterations == 0);
+  REQUIRE(sum_rows(block) == 120);
+  REQUIRE(block.stats->conflict_iterations == banks);
+  REQUIRE(block.stats->max_ii == 2);
+
+  // Without partitioning, the 2 ports of a single memory are the limit
+  REQUIRE(sum_rows(none) == 120);
+  REQUIRE(none.stats->stall_cycles == banks);
+  REQUIRE(none.stats->max_ii == 2);
+
+  // The registers of a complete partitioning are not monitored
+  REQUIRE(complete.stats == nullptr);
+  REQUIRE(sum_rows(complete) == 120);
+
+  std::ostringstream report;
+  report_bank_statistics(report);
+  REQUIRE(report.str().find("cyclic partitioned array of 16 elements in 4 "
+                            "banks: 8 iterations, 32 accesses, 4 iterations "
+                            "with bank conflicts, 4 stall cycles, II = 2")
+          != std::string::npos);
+
+  reset_bank_statistics();
+  REQUIRE(cyclic.stats->iterations == 0);
+  REQUIRE(cyclic.stats->bank_accesses.size() == banks);
+}
+
+
+TEST_CASE("bank statistics of a kernel", "[bank statistics]") {
+  buffer<int> out { banks };
+  queue q;
+  // Run the kernel twice to accumulate the statistics of the same array
+  for (int k = 0; k < 2; ++k)
+    q.submit([&] (handler &cgh) {
+        auto a_out = out.get_access<access::mode::discard_write>(cgh);
+        cgh.single_task<class rows>([=] {
+            partition_array<int, size, partition::cyclic<banks>> a;
+            for (std::size_t i = 0; i < size; ++i)
+              a[i] = i;
+            for (std::size_t i = 0; i < banks; ++i)
+              pipeline([&] {
+                  a_out[i] = a[i*banks] + a[i*banks + 1]
+                    + a[i*banks + 2] + a[i*banks + 3];
+                });
+          });
+      });
+  q.wait();
+  std::ostringstream report;
+  report_bank_statistics(report);
+  REQUIRE(report.str().find("in 4 banks: 8 iterations, 32 accesses, 0 "
+                            "iterations with bank conflicts, 0 stall cycles, "
+                            "II = 1") != std::string::npos);
+  auto a_out = out.get_access<access::mode::read>();
+  REQUIRE(a_out[3] == 54);
+}
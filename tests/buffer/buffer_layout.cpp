@@ -0,0 +1,166 @@
+/* RUN: %{execute}%s
+
+   Check the buffers with a column-major or a strided mdspan layout
+   and the loop order of the parallel_for on them
+*/
+#include <sycl/sycl.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace sycl;
+
+constexpr std::size_t rows = 5;
+constexpr std::size_t columns = 7;
+
+using dextents2 = std::dextents<std::size_t, 2>;
+
+TEST_CASE("column-major host data", "[buffer]") {
+  // Some data coming from a Fortran code for example
+  std::vector<int> v(rows*columns);
+  {
+    std::mdspan<int, dextents2, std::layout_left> m { v.data(),
+                                                      dextents2 { rows,
+                                                                  columns } };
+    buffer b { m };
+    STATIC_REQUIRE(std::is_same_v<decltype(b)::layout_type, std::layout_left>);
+    REQUIRE(b.get_range() == range<2> { rows, columns });
+    queue q;
+    q.submit([&](handler& cgh) {
+      auto a = b.get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(b.get_range(), [=](item<2> i) {
+        a[i] = 10*i[0] + i[1];
+      });
+    });
+    auto a = b.get_access<access::mode::read>();
+    // The logical indexing does not depend on the layout
+    for (std::size_t i = 0; i < rows; ++i)
+      for (std::size_t j = 0; j < columns; ++j)
+        REQUIRE(a[i][j] == 10*i + j);
+  }
+  // But the memory is in column-major order
+  for (std::size_t i = 0; i < rows; ++i)
+    for (std::size_t j = 0; j < columns; ++j)
+      REQUIRE(v[i + j*rows] == 10*i + j);
+}
+
+
+TEST_CASE("strided host data", "[buffer]") {
+  // Use only 1 element out of 2 in the memory
+  std::vector<int> v(2*rows*columns, -1);
+  {
+    std::layout_stride::mapping<dextents2> m {
+      dextents2 { rows, columns }, std::array<std::size_t, 2> { 2*columns,
+                                                                2 } };
+    std::mdspan<int, dextents2, std::layout_stride> s { v.data(), m };
+    buffer b { s };
+    queue q;
+    q.submit([&](handler& cgh) {
+      auto a = b.get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(b.get_range(), [=](id<2> i) {
+        a[i] = 10*i[0] + i[1];
+      });
+    });
+  }
+  for (std::size_t k = 0; k < v.size(); ++k)
+    REQUIRE(v[k] == (k % 2 ? -1 : 10*(k/(2*columns)) + k%(2*columns)/2));
+}
+
+
+TEST_CASE("buffer owning column-major memory", "[buffer]") {
+  buffer<int, 2, buffer_allocator<int>, std::layout_left> b { { rows,
+                                                                columns } };
+  queue q;
+  q.submit([&](handler& cgh) {
+    accessor a { b, cgh };
+    cgh.parallel_for(b.get_range(), [=](id<2> i) { a[i] = 10*i[0] + i[1]; });
+  });
+  host_accessor a { b };
+  for (std::size_t i = 0; i < rows; ++i)
+    for (std::size_t j = 0; j < columns; ++j)
+      REQUIRE(a[i][j] == 10*i + j);
+  // The first dimension is contiguous in memory
+  REQUIRE(&a[1][0] - &a[0][0] == 1);
+  REQUIRE(&a[0][1] - &a[0][0] == rows);
+}
+
+
+#ifndef _OPENMP
+/* With a sequential execution, check that the work-items are executed
+   in the memory order */
+TEST_CASE("loop order follows the memory layout", "[parallel_for]") {
+  std::atomic<int> counter;
+  auto order_of = [&](auto& b) {
+    counter = 0;
+    queue q;
+    q.submit([&](handler& cgh) {
+      auto a = b.template get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(b.get_range(), [=, c = &counter](id<2> i) {
+        a[i] = (*c)++;
+      });
+    });
+    q.wait();
+  };
+
+  std::vector<int> column_major(rows*columns);
+  {
+    buffer b { std::mdspan<int, dextents2, std::layout_left> {
+        column_major.data(), dextents2 { rows, columns } } };
+    order_of(b);
+  }
+  for (std::size_t k = 0; k < column_major.size(); ++k)
+    REQUIRE(column_major[k] == k);
+
+  std::vector<int> row_major(rows*columns);
+  {
+    buffer b { row_major.data(), range<2> { rows, columns } };
+    order_of(b);
+  }
+  for (std::size_t k = 0; k < row_major.size(); ++k)
+    REQUIRE(row_major[k] == k);
+}
+#endif
+
+
+/* Whatever the number of threads running the outermost loop, check
+   that each thread visits the work-items in the memory order: each
+   visit is the next element in memory or starts a new contiguous line
+   of the layout */
+TEST_CASE("each thread follows the memory layout", "[parallel_for]") {
+  std::mutex m;
+  std::map<std::thread::id, std::vector<std::size_t>> visits;
+  auto check_order = [&](auto& b, auto offset, std::size_t line) {
+    visits.clear();
+    queue q;
+    q.submit([&](handler& cgh) {
+      auto a = b.template get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(b.get_range(), [=, &m, &visits](id<2> i) {
+        a[i] = 0;
+        std::lock_guard lock { m };
+        visits[std::this_thread::get_id()].push_back(offset(i));
+      });
+    });
+    q.wait();
+    std::size_t count = 0;
+    for (auto& [thread, offsets] : visits) {
+      REQUIRE(offsets.front() % line == 0);
+      for (std::size_t k = 1; k < offsets.size(); ++k)
+        REQUIRE((offsets[k] == offsets[k - 1] + 1 || offsets[k] % line == 0));
+      count += offsets.size();
+    }
+    REQUIRE(count == rows*columns);
+  };
+
+  std::vector<int> column_major(rows*columns);
+  buffer cm { std::mdspan<int, dextents2, std::layout_left> {
+      column_major.data(), dextents2 { rows, columns } } };
+  check_order(cm, [](id<2> i) { return i[0] + i[1]*rows; }, rows);
+
+  buffer<int, 2> rm { range<2> { rows, columns } };
+  check_order(rm, [](id<2> i) { return i[0]*columns + i[1]; }, columns);
+}
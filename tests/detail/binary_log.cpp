@@ -0,0 +1,130 @@
+/* RUN: %{execute}%s
+
+   Test the binary logger of the runtime and its decoder
+*/
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+/// Test explicitly an internal feature of triSYCL
+#include "triSYCL/detail/binary_log.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace trisycl::detail;
+
+enum class color : std::uint8_t { red, green };
+
+/// Decode what has been logged so far
+std::string decoded() {
+  std::stringstream binary;
+  binary_log::dump(binary);
+  std::stringstream text;
+  binary_log::decode(binary, text);
+  return text.str();
+}
+
+TEST_CASE("messages are recorded according to the levels", "[binary_log]") {
+  binary_log::set_level(binary_log::subsystem::pipe, 2);
+  int i = -3;
+  TRISYCL_BLOG(pipe, 1, "no argument");
+  TRISYCL_BLOG(pipe, 2, "i = {}, u = {}, f = {}", i, 42u, 0.5);
+  TRISYCL_BLOG(pipe, 2, "b = {} c = {} e = {} p = {}", true, 'x', color::green,
+               nullptr);
+  // Above the level of the subsystem
+  TRISYCL_BLOG(pipe, 3, "too verbose {}", i);
+  // In another subsystem
+  TRISYCL_BLOG(router, 1, "disabled {}", i);
+  // In another thread
+  std::thread { [] { TRISYCL_BLOG(pipe, 1, "from another thread"); } }.join();
+  auto text = decoded();
+  std::cout << text;
+  REQUIRE(text.find("pipe binary_log.cpp:") != std::string::npos);
+  REQUIRE(text.find(" no argument\n") != std::string::npos);
+  REQUIRE(text.find(" i = -3, u = 42, f = 0.5\n") != std::string::npos);
+  REQUIRE(text.find(" b = true c = x e = 1 p = 0x0\n") != std::string::npos);
+  REQUIRE(text.find("[1] pipe") != std::string::npos);
+  REQUIRE(text.find("too verbose") == std::string::npos);
+  REQUIRE(text.find("disabled") == std::string::npos);
+  binary_log::set_level(binary_log::subsystem::pipe, 0);
+}
+
+TEST_CASE("only the latest messages are kept", "[binary_log]") {
+  binary_log::set_level(binary_log::subsystem::task, 1);
+  std::thread { [] {
+    for (std::size_t i = 0; i < 3 * binary_log::ring_size; ++i)
+      TRISYCL_BLOG(task, 1, "message {}", i);
+  } }.join();
+  auto text = decoded();
+  REQUIRE(text.find(" message " + std::to_string(2 * binary_log::ring_size)
+                    + '\n') != std::string::npos);
+  REQUIRE(text.find(" message " + std::to_string(3 * binary_log::ring_size - 1)
+                    + '\n') != std::string::npos);
+  REQUIRE(text.find(" message " + std::to_string(2 * binary_log::ring_size - 1)
+                    + '\n') == std::string::npos);
+  binary_log::set_level(binary_log::subsystem::task, 0);
+}
+
+TEST_CASE("disabled logging records nothing", "[binary_log]") {
+  auto log = [] {
+    for (int i = 0; i < 3; ++i)
+      TRISYCL_BLOG(general, 1, "iteration {} of {}", i, 3);
+  };
+  binary_log::set_level(binary_log::subsystem::general, 0);
+  log();
+  REQUIRE(decoded().find(" iteration ") == std::string::npos);
+  binary_log::set_level(binary_log::subsystem::general, 1);
+  log();
+  REQUIRE(decoded().find(" iteration 2 of 3\n") != std::string::npos);
+  // Do not write any log file at exit
+  binary_log::set_level(binary_log::subsystem::general, 0);
+}
+
+TEST_CASE("invalid input is rejected", "[binary_log]") {
+  std::stringstream in { "not a log" };
+  std::stringstream out;
+  REQUIRE_THROWS_AS(binary_log::decode(in, out), std::runtime_error);
+}
+
+TEST_CASE("corrupted call sites are rejected", "[binary_log]") {
+  auto corrupt = [](std::uint8_t nargs, std::string format) {
+    std::stringstream in;
+    auto put = [&](auto v) {
+      in.write(reinterpret_cast<const char*>(&v), sizeof(v));
+    };
+    auto put_string = [&](const std::string& s) {
+      put(static_cast<std::uint32_t>(s.size()));
+      in.write(s.data(), s.size());
+    };
+    in.write("TSBLOG1\n", 8);
+    // A single call site
+    put(std::uint32_t { 1 });
+    put(std::uint32_t { 0 });
+    put_string(format);
+    put_string("file.cpp");
+    put(std::int32_t { 1 });
+    put(binary_log::subsystem::general);
+    put(std::int32_t { 1 });
+    put(nargs);
+    for (std::uint8_t a = 0; a < nargs; ++a)
+      put(binary_log::arg_type::unsigned_integer);
+    // A single message
+    put(std::uint64_t { 1 });
+    put(std::uint32_t { 0 });
+    put(std::uint32_t { 0 });
+    put(std::uint64_t { 0 });
+    for (std::uint8_t a = 0; a < nargs; ++a)
+      put(std::uint64_t { a });
+    std::stringstream out;
+    binary_log::decode(in, out);
+    return out.str();
+  };
+  REQUIRE(corrupt(2, "{} and {}").find(" 0 and 1\n") != std::string::npos);
+  // More arguments than a message can hold
+  REQUIRE_THROWS_AS(corrupt(7, "{} {} {} {} {} {} {}"), std::runtime_error);
+  // Not enough {} in the format for the arguments
+  REQUIRE_THROWS_AS(corrupt(2, "{} only"), std::runtime_error);
+}
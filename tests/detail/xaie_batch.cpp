@@ -0,0 +1,101 @@
+/* RUN: %{execute}%s
+
+   Test the batching of the host-device memory transfers of the aie::
+   runtime on the host-memory stand-in of the device memory
+*/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+
+/// Test explicitly an internal feature of the aie:: runtime
+#include "aie/detail/xaie_batch.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace aie;
+using namespace aie::detail::xaie;
+
+// Use precise time measurement
+using clk = std::chrono::high_resolution_clock;
+
+TEST_CASE("adjacent and overlapping writes are coalesced", "[xaie_batch]") {
+  host_memory mem;
+  auto h = mem.get_handle({ 1, 2 });
+  std::array<std::uint32_t, 8> v;
+  std::iota(v.begin(), v.end(), 1);
+  {
+    transfer_batch batch { h };
+    // 8 adjacent word writes
+    for (std::uint32_t i = 0; i < v.size(); ++i)
+      batch.store(0x100 + 4 * i, v[i]);
+    // A later write overrides an earlier one
+    batch.store(0x108, std::uint32_t { 42 });
+    // A disjoint write on the same tile and a write on another tile
+    batch.store(0x200, std::uint32_t { 7 });
+    batch.memcpy_h2d({ 2, 2 }, 0x100, v.data(), sizeof(v));
+    REQUIRE(mem.get_stats().transfers == 0);
+    batch.submit();
+    REQUIRE(batch.get_stats().requests == 11);
+    REQUIRE(batch.get_stats().transfers == 3);
+    REQUIRE(mem.get_stats().transfers == 3);
+    REQUIRE(mem.get_stats().bytes == 2 * sizeof(v) + 4);
+  }
+  REQUIRE(h.load<std::uint32_t>(0x100) == 1);
+  REQUIRE(h.load<std::uint32_t>(0x104) == 2);
+  REQUIRE(h.load<std::uint32_t>(0x108) == 42);
+  REQUIRE(h.load<std::uint32_t>(0x11c) == 8);
+  REQUIRE(h.load<std::uint32_t>(0x200) == 7);
+  REQUIRE(h.on(2, 2).load<std::uint32_t>(0x11c) == 8);
+}
+
+TEST_CASE("reads are coalesced and see the writes", "[xaie_batch]") {
+  host_memory mem;
+  auto h = mem.get_handle({ 0, 0 });
+  std::array<std::uint32_t, 16> in;
+  std::iota(in.begin(), in.end(), 100);
+  std::array<std::uint32_t, 16> out {};
+  std::uint32_t overlap = 0;
+  {
+    transfer_batch batch { h };
+    batch.memcpy_h2d(0, in.data(), sizeof(in));
+    // Read in reverse order to check the sorting
+    for (std::uint32_t i = in.size(); i-- > 0;)
+      batch.load(4 * i, out[i]);
+    batch.load(0x8, overlap);
+  } // Submitted on destruction
+  REQUIRE(out == in);
+  REQUIRE(overlap == 102);
+  // 1 write and 1 read
+  REQUIRE(mem.get_stats().transfers == 2);
+}
+
+TEST_CASE("batching reduces the number of transfers", "[xaie_batch]") {
+  constexpr int tiles = 50;
+  constexpr std::uint32_t words = 1024;
+  auto run = [](bool batched) {
+    host_memory mem;
+    auto h = mem.get_handle({ 0, 0 });
+    auto starting_point = clk::now();
+    if (batched) {
+      transfer_batch batch { h };
+      for (int t = 0; t < tiles; ++t)
+        for (std::uint32_t i = 0; i < words; ++i)
+          batch.memcpy_h2d({ t, 0 }, 4 * i, &i, sizeof(i));
+    } else
+      for (int t = 0; t < tiles; ++t)
+        for (std::uint32_t i = 0; i < words; ++i)
+          h.on(t, 0).store(4 * i, i);
+    std::chrono::duration<double> d = clk::now() - starting_point;
+    std::cout << (batched ? "batched" : "direct") << ": "
+              << mem.get_stats().transfers << " transfers in " << d.count()
+              << " s" << std::endl;
+    REQUIRE(h.on(tiles - 1, 0).load<std::uint32_t>(4 * (words - 1))
+            == words - 1);
+    return mem.get_stats().transfers - 1;
+  };
+  REQUIRE(run(false) == tiles * words);
+  REQUIRE(run(true) == tiles);
+}
@@ -0,0 +1,119 @@
+/* RUN: %{execute}%s
+
+   Test the triSYCL extension fusing element-wise parallel_for kernels
+*/
+#include <CL/sycl.hpp>
+
+#include "triSYCL/vendor/triSYCL/fusion.hpp"
+
+#include <numeric>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cl::sycl;
+
+constexpr std::size_t M = 37;
+constexpr std::size_t N = 29;
+
+TEST_CASE("fuse a chain of map kernels", "[fusion]") {
+  buffer<int, 2> a { range<2> { M, N } };
+  buffer<int, 2> b { range<2> { M, N } };
+  queue q;
+  {
+    // Use small blocks to have several of them
+    vendor::trisycl::kernel_fusion f { q, 100 };
+    q.submit([&](handler &cgh) {
+      auto wa = a.get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(range<2> { M, N }, [=](item<2> i) {
+        wa[i] = i[0]*N + i[1];
+      });
+    });
+    q.submit([&](handler &cgh) {
+      auto ra = a.get_access<access::mode::read>(cgh);
+      auto wb = b.get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(range<2> { M, N }, [=](id<2> i) {
+        wb[i] = 2*ra[i];
+      });
+    });
+    q.submit([&](handler &cgh) {
+      auto rwa = a.get_access<access::mode::read_write>(cgh);
+      auto rb = b.get_access<access::mode::read>(cgh);
+      cgh.parallel_for(range<2> { M, N }, [=](id<2> i) {
+        rwa[i] += rb[i];
+      });
+    });
+  }
+  auto ra = a.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < M; ++i)
+    for (std::size_t j = 0; j < N; ++j)
+      REQUIRE(ra[i][j] == 3*(i*N + j));
+}
+
+
+TEST_CASE("flush on range change and on wait", "[fusion]") {
+  queue q;
+  auto x = malloc_shared<int>(M, q);
+  vendor::trisycl::kernel_fusion f { q };
+  auto e1 = q.parallel_for(range<1> { M }, [=](id<1> i) { x[i[0]] = 1; });
+  auto e2 = q.parallel_for(range<1> { M }, [=](id<1> i) { x[i[0]] += 2; });
+  // A different range cannot be fused, so this flushes the previous kernels
+  q.parallel_for(range<1> { M - 1 }, [=](id<1> i) { x[i[0]] *= 2; }, e2);
+  // Waiting for a deferred kernel executes it
+  e1.wait();
+  REQUIRE(e1.get_info<info::event::command_execution_status>()
+          == info::event_command_status::complete);
+  e2.wait();
+  q.wait();
+  for (std::size_t i = 0; i < M - 1; ++i)
+    REQUIRE(x[i] == 6);
+  REQUIRE(x[M - 1] == 3);
+  free(x, q);
+}
+
+
+TEST_CASE("host accessors wait for the deferred kernels", "[fusion]") {
+  queue q;
+  vendor::trisycl::kernel_fusion f { q };
+  buffer<int> a { M };
+  {
+    buffer<int> b { M };
+    q.submit([&](handler &cgh) {
+      auto wa = a.get_access<access::mode::discard_write>(cgh);
+      auto wb = b.get_access<access::mode::discard_write>(cgh);
+      cgh.parallel_for(range<1> { M }, [=](id<1> i) {
+        wa[i] = i[0];
+        wb[i] = 1;
+      });
+    });
+    q.submit([&](handler &cgh) {
+      auto rwa = a.get_access<access::mode::read_write>(cgh);
+      auto rb = b.get_access<access::mode::read>(cgh);
+      cgh.parallel_for(range<1> { M }, [=](id<1> i) { rwa[i] += rb[i]; });
+    });
+    // The destruction of b has to wait for the pending kernels
+  }
+  // Without any explicit flush
+  auto ra = a.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < M; ++i)
+    REQUIRE(ra[i] == i + 1);
+}
+
+
+TEST_CASE("other queues wait for the deferred kernels", "[fusion]") {
+  queue q1, q2;
+  buffer<int> a { M };
+  vendor::trisycl::kernel_fusion f { q1 };
+  q1.submit([&](handler &cgh) {
+    auto wa = a.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for(range<1> { M }, [=](id<1> i) { wa[i] = 2; });
+  });
+  // The kernel on the other queue depends on the deferred kernel
+  q2.submit([&](handler &cgh) {
+    auto rwa = a.get_access<access::mode::read_write>(cgh);
+    cgh.parallel_for(range<1> { M }, [=](id<1> i) { rwa[i] *= 3; });
+  });
+  q2.wait();
+  auto ra = a.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < M; ++i)
+    REQUIRE(ra[i] == 6);
+}
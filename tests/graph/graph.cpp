@@ -0,0 +1,116 @@
+/* RUN: %{execute}%s
+
+   Test the triSYCL extension recording command groups in a graph to
+   replay them later
+*/
+#include <CL/sycl.hpp>
+
+#include "triSYCL/vendor/triSYCL/graph.hpp"
+
+#include <numeric>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cl::sycl;
+
+constexpr std::size_t size = 100;
+
+TEST_CASE("replay buffer command groups", "[graph]") {
+  buffer<int> a { size };
+  buffer<int> b { size };
+  {
+    auto w = a.get_access<access::mode::discard_write>();
+    std::iota(w.begin(), w.end(), 0);
+  }
+  queue q;
+  {
+    vendor::trisycl::command_graph g;
+    g.begin_recording(q);
+    // b = a + 1
+    q.submit([&](handler &cgh) {
+      auto ra = a.get_access<access::mode::read>(cgh);
+      auto wb = b.get_access<access::mode::write>(cgh);
+      cgh.parallel_for(range<1> { size },
+                       [=](id<1> i) { wb[i] = ra[i] + 1; });
+    });
+    // a = 2*b
+    q.submit([&](handler &cgh) {
+      auto wa = a.get_access<access::mode::write>(cgh);
+      auto rb = b.get_access<access::mode::read>(cgh);
+      cgh.parallel_for(range<1> { size },
+                       [=](id<1> i) { wa[i] = 2*rb[i]; });
+    });
+    g.end_recording();
+    REQUIRE(g.size() == 2);
+    // Nothing has been executed while recording
+    REQUIRE(a.get_access<access::mode::read>()[3] == 3);
+    g.finalize();
+    for (int i = 0; i < 3; ++i)
+      g.run(q);
+    q.wait();
+  }
+  auto ra = a.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < size; ++i)
+    // (((i + 1)*2 + 1)*2 + 1)*2
+    REQUIRE(ra[i] == 8*i + 14);
+}
+
+
+TEST_CASE("replay independent USM command groups", "[graph]") {
+  queue q;
+  auto x = malloc_shared<int>(size, q);
+  auto y = malloc_shared<int>(size, q);
+  {
+    vendor::trisycl::command_graph g;
+    g.begin_recording(q);
+    // The 2 fills are independent and can run concurrently
+    auto fx = q.fill(x, 1, size);
+    auto fy = q.fill(y, 2, size);
+    auto e = q.parallel_for(range<1> { size }, [=](item<1> i) {
+      x[i[0]] += y[i[0]];
+    }, { fx, fy });
+    g.end_recording();
+    // Record directly one more command group
+    g.add(q, [&](handler &cgh) {
+      cgh.depends_on(e);
+      cgh.single_task([=] { y[0] = x[0]; });
+    });
+    REQUIRE(g.size() == 4);
+    g.finalize();
+    g.run(q).wait();
+  }
+  for (std::size_t i = 0; i < size; ++i)
+    REQUIRE(x[i] == 3);
+  REQUIRE(y[0] == 3);
+  REQUIRE(y[1] == 2);
+  free(x, q);
+  free(y, q);
+}
+
+
+TEST_CASE("replay an empty graph", "[graph]") {
+  queue q;
+  vendor::trisycl::command_graph g;
+  g.begin_recording(q);
+  g.end_recording();
+  g.finalize();
+  REQUIRE(g.size() == 0);
+  // There is nothing to execute, so the event is already complete
+  auto e = g.run(q);
+  REQUIRE(e.get_info<info::event::command_execution_status>()
+          == info::event_command_status::complete);
+  e.wait();
+  q.wait();
+}
+
+
+TEST_CASE("a queue is recorded by only one graph", "[graph]") {
+  queue q;
+  vendor::trisycl::command_graph g1, g2;
+  g1.begin_recording(q);
+  REQUIRE_THROWS_AS(g2.begin_recording(q), invalid_object_error);
+  g1.end_recording();
+  // The queue can be recorded again once released
+  g2.begin_recording(q);
+  g2.end_recording();
+}
@@ -0,0 +1,145 @@
+/* RUN: %{execute}%s
+
+   Test the group algorithms
+*/
+#include <CL/sycl.hpp>
+
+#include <functional>
+#include <numeric>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cl::sycl;
+
+constexpr size_t N = 64;
+#if defined(_OPENMP) && !defined(TRISYCL_NO_BARRIER)
+// With the default OpenMP execution the work-items are cooperating threads
+constexpr size_t WG = 16;
+constexpr size_t WG_SIDE = 4;
+#else
+/* Without cooperating work-item threads only trivial work-groups work
+   and the others make the kernel fail */
+constexpr size_t WG = 1;
+constexpr size_t WG_SIDE = 1;
+#endif
+
+TEST_CASE("group algorithms in nd_range kernels", "[group]") {
+  buffer<int> broadcast { N }, reduce { N }, exclusive { N }, inclusive { N };
+  buffer<bool> any { N }, all { N };
+  queue q;
+  q.submit([&](handler &cgh) {
+    auto a_broadcast = broadcast.get_access<access::mode::discard_write>(cgh);
+    auto a_reduce = reduce.get_access<access::mode::discard_write>(cgh);
+    auto a_exclusive = exclusive.get_access<access::mode::discard_write>(cgh);
+    auto a_inclusive = inclusive.get_access<access::mode::discard_write>(cgh);
+    auto a_any = any.get_access<access::mode::discard_write>(cgh);
+    auto a_all = all.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for<class algorithms>(nd_range<1> { N, WG },
+                                       [=](nd_item<1> it) {
+      auto i = it.get_global_id(0);
+      int x = i;
+      a_broadcast[i] = group_broadcast(it, x, WG - 1);
+      a_reduce[i] = reduce_over_group(it, x, std::plus<>{});
+      a_exclusive[i] = exclusive_scan_over_group(it, x, std::plus<>{});
+      a_inclusive[i] = inclusive_scan_over_group(it, x, std::plus<>{});
+      a_any[i] = any_of_group(it, x == 3);
+      a_all[i] = all_of_group(it, x < 32);
+    });
+  });
+  auto a_broadcast = broadcast.get_access<access::mode::read>();
+  auto a_reduce = reduce.get_access<access::mode::read>();
+  auto a_exclusive = exclusive.get_access<access::mode::read>();
+  auto a_inclusive = inclusive.get_access<access::mode::read>();
+  auto a_any = any.get_access<access::mode::read>();
+  auto a_all = all.get_access<access::mode::read>();
+  for (size_t i = 0; i < N; ++i) {
+    size_t first = i - i%WG;
+    size_t last = first + WG - 1;
+    REQUIRE(a_broadcast[i] == last);
+    REQUIRE(a_reduce[i] == (first + last)*WG/2);
+    REQUIRE(a_exclusive[i] == (first + i)*(i - first + 1)/2 - i);
+    REQUIRE(a_inclusive[i] == (first + i)*(i - first + 1)/2);
+    REQUIRE(a_any[i] == (first <= 3 && 3 <= last));
+    REQUIRE(a_all[i] == (last < 32));
+  }
+}
+
+
+TEST_CASE("group algorithms in 2D nd_range kernels", "[group]") {
+  constexpr size_t side = 8;
+  constexpr size_t wg_size = WG_SIDE*WG_SIDE;
+  buffer<int, 2> reduce { { side, side } }, scan { { side, side } };
+  buffer<int, 2> broadcast { { side, side } };
+  queue q;
+  q.submit([&](handler &cgh) {
+    auto a_reduce = reduce.get_access<access::mode::discard_write>(cgh);
+    auto a_scan = scan.get_access<access::mode::discard_write>(cgh);
+    auto a_broadcast = broadcast.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for<class algorithms_2d>(
+      nd_range<2> { { side, side }, { WG_SIDE, WG_SIDE } },
+      [=](nd_item<2> it) {
+        auto g = it.get_global_id();
+        // The value of a work-item is its local linear id
+        int x = it.get_local_linear_id();
+        // Several calls in a row use the 2 banks of the scratch memory
+        for (int k = 0; k < 3; ++k) {
+          a_reduce[g] = reduce_over_group(it, x, std::plus<>{});
+          a_scan[g] = exclusive_scan_over_group(it, x, std::plus<>{});
+          a_broadcast[g] = group_broadcast(it, x + k,
+                                           id<2> { 0, WG_SIDE - 1 });
+        }
+      });
+  });
+  auto a_reduce = reduce.get_access<access::mode::read>();
+  auto a_scan = scan.get_access<access::mode::read>();
+  auto a_broadcast = broadcast.get_access<access::mode::read>();
+  for (size_t i = 0; i < side; ++i)
+    for (size_t j = 0; j < side; ++j) {
+      // The local linear id has the dimension 0 varying the fastest
+      size_t me = i % WG_SIDE + (j % WG_SIDE)*WG_SIDE;
+      REQUIRE(a_reduce[i][j] == wg_size*(wg_size - 1)/2);
+      REQUIRE(a_scan[i][j] == me*(me - 1)/2);
+      REQUIRE(a_broadcast[i][j] == (WG_SIDE - 1)*WG_SIDE + 2);
+    }
+}
+
+
+TEST_CASE("joint algorithms in hierarchical kernels", "[group]") {
+  constexpr size_t groups = 4;
+  buffer<int> a { N };
+  buffer<int> scan { N };
+  buffer<int> sum { groups };
+  buffer<bool> any { groups };
+  {
+    auto a_a = a.get_access<access::mode::discard_write>();
+    std::iota(a_a.begin(), a_a.end(), 0);
+  }
+  queue q;
+  q.submit([&](handler &cgh) {
+    auto a_a = a.get_access<access::mode::read>(cgh);
+    auto a_scan = scan.get_access<access::mode::discard_write>(cgh);
+    auto a_sum = sum.get_access<access::mode::discard_write>(cgh);
+    auto a_any = any.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for_work_group<class joint>(nd_range<1> { groups, 1 },
+                                             [=](group<1> g) {
+      auto first = &a_a[g.get_id(0)*(N/groups)];
+      auto last = first + N/groups;
+      a_sum[g.get_id(0)] = joint_reduce(g, first, last, std::plus<>{});
+      joint_inclusive_scan(g, first, last, &a_scan[g.get_id(0)*(N/groups)],
+                           std::plus<>{});
+      a_any[g.get_id(0)] = joint_any_of(g, first, last,
+                                        [](int v) { return v == 20; });
+    });
+  });
+  auto a_sum = sum.get_access<access::mode::read>();
+  auto a_any = any.get_access<access::mode::read>();
+  auto a_scan = scan.get_access<access::mode::read>();
+  for (size_t g = 0; g < groups; ++g) {
+    size_t first = g*(N/groups);
+    size_t last = first + N/groups - 1;
+    REQUIRE(a_sum[g] == (first + last)*(N/groups)/2);
+    REQUIRE(a_any[g] == (first <= 20 && 20 <= last));
+    for (size_t i = first; i <= last; ++i)
+      REQUIRE(a_scan[i] == (first + i)*(i - first + 1)/2);
+  }
+}
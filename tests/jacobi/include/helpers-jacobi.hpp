@@ -5,6 +5,7 @@
 #include <boost/lexical_cast.hpp>
 
 // ISO C++
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
@@ -58,6 +59,18 @@ int es = PAPI_NULL; //event set
 #define USE_INIT_FT 1 // first touch accordingly to the sycl or malloc allocation
 #endif
 
+#ifndef TEMPORAL_BLOCKING
+#define TEMPORAL_BLOCKING 1 // run the stencil DSEL with temporal blocking on host
+#endif
+
+#ifndef J_HOST_L2_CACHE_SIZE
+#define J_HOST_L2_CACHE_SIZE (256*1024)
+#endif
+
+#ifndef J_HOST_TIME_BLOCK
+#define J_HOST_TIME_BLOCK 4 // iterations done per tile with temporal blocking
+#endif
+
 #define J_CL_DEVICE_LOCAL_MEM_SIZE 5000
 #define J_CL_DEVICE_CONST_WORK_GROUP_SIZE0 8
 #define J_CL_DEVICE_CONST_WORK_GROUP_SIZE1 8
@@ -87,6 +100,8 @@ struct counters
 
     clock_type::time_point start, end_init, end;
     duration_type init_time, load_time, stencil_time, copy_time;
+    // stencil time with 1 iteration per kernel, to compare with
+    duration_type sweep_time {};
     long long * papi_values_l;
     long long * papi_values_s;
 };
@@ -192,6 +207,12 @@ inline void end_measure(struct counters& timer)
     std::cout << "Copy................time (ms) : " << timer.copy_time.count() << std::endl;
     std::cout << "Subtotal............time (ms) : " << (timer.init_time + timer.load_time + timer.stencil_time + timer.copy_time).count() << std::endl;
     std::cout << "Total (with instr.) time (ms) : " << tot_time.count() << std::endl;
+    if (timer.sweep_time.count() > 0) {
+      std::cout << "1 iteration/kernel..time (ms) : " << timer.sweep_time.count() << std::endl;
+      std::cout << "Temporal blocking speedup     : "
+                << (double) timer.sweep_time.count() / std::max<counters::duration_type::rep>(timer.stencil_time.count(), 1)
+                << std::endl;
+    }
 #if USE_PAPI
   if (nb_papi_event > 0) {
     std::cout << "Loading counters" << std::endl;;
@@ -3,5 +3,6 @@
 
 #include "stencil-fxd.hpp"
 #include "stencil-var.hpp"
+#include "stencil-nd.hpp"
 
 #endif 
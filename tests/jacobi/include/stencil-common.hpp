@@ -1,6 +1,9 @@
 #ifndef __STENCIL_COMMON__HPP_
 #define __STENCIL_COMMON__HPP_
 
+#include <algorithm>
+#include <vector>
+
 #include "CL/sycl.hpp"
 
 #include "helpers-jacobi.hpp"
@@ -54,4 +57,89 @@ public:
   static const int nbi_wg1 = _nbi_wg1;
 };
 
+// temporal blocking on host
+
+constexpr int temporal_tile_side(int size_of_T, int d0, int d1, int time_block) {
+  int side = 1;
+  while (2 * size_of_T * (side + 1 + time_block * d0) * (side + 1 + time_block * d1) <= J_HOST_L2_CACHE_SIZE)
+    ++side;
+  return side;
+}
+
+/* Size the tiles for the temporal blocking, such that the 2 local
+   arrays of a tile with the halo needed by _time_block iterations fit
+   in the L2 cache */
+template <typename T, int d0, int d1, int _time_block = J_HOST_TIME_BLOCK>
+class temporal_info2D {
+public:
+  static_assert(2 * sizeof(T) * (1 + _time_block * d0) * (1 + _time_block * d1) <= J_HOST_L2_CACHE_SIZE, "Stencil too large for the cache.");
+  static const int time_block = _time_block;
+  static const int nbi_tile0 = temporal_tile_side(sizeof(T), d0, d1, time_block);
+  static const int nbi_tile1 = nbi_tile0;
+  static const int local_dim0 = nbi_tile0 + time_block * d0;
+  static const int local_dim1 = nbi_tile1 + time_block * d1;
+};
+
+/* Compute steps <= time_block iterations of a stencil on a tile of the
+   inner part of an array, the ghost cells around being constant.
+
+   The tile is loaded with a halo of steps times the stencil extent in
+   a local array. Each iteration computes into a second local array a
+   region shrinking by the stencil extent, then both are swapped, so
+   the last iteration computes exactly the tile (a trapezoid in the
+   time dimension). The halos overlapping the neighbour tiles are
+   computed redundantly, so the tiles are independent.
+
+   load(i, j) reads the input array, compute(local, i_local, j_local,
+   i, j) evaluates the stencil on a local array and store(i, j, value)
+   writes the output array. The tile writes also the ghost cells along
+   it, so the output has the same borders as the input. */
+template <class ti2D, int of0, int of1, int pad0, int pad1, typename T, class Load, class Compute, class Store>
+inline void temporal_tile2D(cl::sycl::id<2> tile, int steps, int glob_max0, int glob_max1, Load load, Compute compute, Store store) {
+  std::vector<T> cur(ti2D::local_dim0 * ti2D::local_dim1);
+  std::vector<T> next(ti2D::local_dim0 * ti2D::local_dim1);
+  int t0 = tile.get(0);
+  int t1 = tile.get(1);
+  int size0 = glob_max0 + of0 + pad0;
+  int size1 = glob_max1 + of1 + pad1;
+  // global indices of the first element of the tile
+  int first0 = of0 + t0 * ti2D::nbi_tile0;
+  int first1 = of1 + t1 * ti2D::nbi_tile1;
+  int nb0 = std::min(ti2D::nbi_tile0, glob_max0 - t0 * ti2D::nbi_tile0);
+  int nb1 = std::min(ti2D::nbi_tile1, glob_max1 - t1 * ti2D::nbi_tile1);
+  // global indices of the local element (0, 0) and extent of the local array used
+  int org0 = first0 - steps * of0;
+  int org1 = first1 - steps * of1;
+  int ext0 = nb0 + steps * (of0 + pad0);
+  int ext1 = nb1 + steps * (of1 + pad1);
+
+  for (int i = std::max(0, -org0); i < std::min(ext0, size0 - org0); ++i)
+    for (int j = std::max(0, -org1); j < std::min(ext1, size1 - org1); ++j)
+      cur[i * ti2D::local_dim1 + j] = load(org0 + i, org1 + j);
+
+  for (int s = 1; s <= steps; ++s) {
+    for (int i = s * of0; i < ext0 - s * pad0; ++i) {
+      int g0 = org0 + i;
+      bool inner0 = g0 >= of0 && g0 < of0 + glob_max0;
+      for (int j = s * of1; j < ext1 - s * pad1; ++j) {
+        int g1 = org1 + j;
+        if (inner0 && g1 >= of1 && g1 < of1 + glob_max1)
+          next[i * ti2D::local_dim1 + j] = compute(cur.data(), i, j, g0, g1);
+        else
+          next[i * ti2D::local_dim1 + j] = cur[i * ti2D::local_dim1 + j];
+      }
+    }
+    std::swap(cur, next);
+  }
+
+  int last0 = first0 + nb0 == of0 + glob_max0 ? size0 : first0 + nb0;
+  int last1 = first1 + nb1 == of1 + glob_max1 ? size1 : first1 + nb1;
+  for (int i = t0 == 0 ? 0 : first0; i < last0; ++i)
+    for (int j = t1 == 0 ? 0 : first1; j < last1; ++j)
+      if (i >= first0 && i < first0 + nb0 && j >= first1 && j < first1 + nb1)
+        store(i, j, cur[(i - org0) * ti2D::local_dim1 + j - org1]);
+      else
+        store(i, j, load(i, j));
+}
+
 #endif 
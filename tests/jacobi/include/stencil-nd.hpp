@@ -0,0 +1,418 @@
+#ifndef STENCIL_INRIA_ND
+#define STENCIL_INRIA_ND
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "stencil-common.hpp"
+
+// N-dimensional fixed coeff
+//
+// The offsets of the coefficients are compile-time packs, so a stencil
+// is evaluated by a fold expression with constant displacements: the
+// inner loops are fully unrolled and can be vectorized.
+
+template <std::size_t D>
+constexpr std::ptrdiff_t linear_nd(std::array<int, D> ind, std::array<std::ptrdiff_t, D> strides) {
+  std::ptrdiff_t l = 0;
+  for (std::size_t k = 0; k < D; ++k)
+    l += ind[k] * strides[k];
+  return l;
+}
+
+constexpr std::size_t pow3_nd(std::size_t d) {
+  return d == 0 ? 1 : 3 * pow3_nd(d - 1);
+}
+
+class auth_in_st_nd {
+protected:
+  auth_in_st_nd () {}
+};
+
+template <typename T, int... I>
+class coef_nd : private auth_in_st_nd {
+public:
+  static_assert(sizeof...(I) >= 1 && sizeof...(I) <= 3, "SYCL supports only 1, 2 or 3 dimensions.");
+  static const int dimensions = sizeof...(I);
+  static constexpr std::array<int, dimensions> ind = { I... };
+
+  coef_nd(T a) : coef(a) {}
+
+  inline auto toStencil() const;
+
+  const T coef;
+};
+
+// the bounding box of the coefficients, including the center
+template <bool upper, int D, class... C>
+constexpr std::array<int, D> bound_nd() {
+  std::array<int, D> b {};
+  ([&] {
+    for (int k = 0; k < D; ++k)
+      b[k] = upper ? std::max(b[k], C::ind[k]) : std::min(b[k], C::ind[k]);
+  }(), ...);
+  return b;
+}
+
+template <typename T, class... C>
+class stencil_nd : private auth_in_st_nd {
+public:
+  static_assert(sizeof...(C) >= 1, "A stencil needs a coef.");
+  static const int dimensions = std::tuple_element_t<0, std::tuple<C...>>::dimensions;
+  static_assert(((C::dimensions == dimensions) && ...), "All the coefs of a stencil must have the same dimension.");
+  static const int nb_coefs = sizeof...(C);
+  static constexpr std::array<int, dimensions> min_ind = bound_nd<false, dimensions, C...>();
+  static constexpr std::array<int, dimensions> max_ind = bound_nd<true, dimensions, C...>();
+
+  stencil_nd(std::tuple<C...> c) : coefs(c) {}
+
+  // evaluation on an accessor around the element i
+  template <class Acc>
+  inline T eval(const Acc &a, cl::sycl::id<dimensions> i) const {
+    return [&]<std::size_t... K>(std::index_sequence<K...>) {
+      return (... + (std::get<K>(coefs).coef * a[shift(i, C::ind)]));
+    }(std::index_sequence_for<C...> {});
+  }
+
+  // evaluation on a local array with compile-time strides around *a
+  template <std::array<std::ptrdiff_t, dimensions> strides>
+  inline T eval_local(const T *a) const {
+    return [&]<std::size_t... K>(std::index_sequence<K...>) {
+      return (... + (std::get<K>(coefs).coef * a[linear_nd(C::ind, strides)]));
+    }(std::index_sequence_for<C...> {});
+  }
+
+  const std::tuple<C...> coefs;
+
+private:
+  static inline cl::sycl::id<dimensions> shift(cl::sycl::id<dimensions> i, std::array<int, dimensions> ind) {
+    for (int k = 0; k < dimensions; ++k)
+      i[k] += ind[k];
+    return i;
+  }
+};
+
+template <typename T, int... I>
+inline auto coef_nd<T, I...>::toStencil() const {
+  return stencil_nd<T, coef_nd<T, I...>> { std::tuple { *this } };
+}
+
+template <typename T, int... I>
+inline stencil_nd<T, coef_nd<T, I...>> to_stencil_nd(coef_nd<T, I...> c) {
+  return c.toStencil();
+}
+
+template <typename T, class... C>
+inline stencil_nd<T, C...> to_stencil_nd(stencil_nd<T, C...> st) {
+  return st;
+}
+
+template <typename T, class... C1, class... C2>
+inline stencil_nd<T, C1..., C2...> concat_nd(stencil_nd<T, C1...> st0, stencil_nd<T, C2...> st1) {
+  return std::tuple_cat(st0.coefs, st1.coefs);
+}
+
+// the coefs are kept flat in the order of the sum
+template <class L, class R>
+  requires std::is_base_of_v<auth_in_st_nd, L> && std::is_base_of_v<auth_in_st_nd, R>
+inline auto operator+ (L left, R right) {
+  return concat_nd(to_stencil_nd(left), to_stencil_nd(right));
+}
+
+// usual stencils
+
+template <typename T, std::size_t K, std::size_t... Dim>
+using star_coef_nd = coef_nd<T, (Dim == K / 2 ? (K % 2 ? 1 : -1) : 0)...>;
+
+/* The 2D+1-point stencil, such as the 5-point 2D or 7-point 3D ones:
+   center times the element plus neighbour times each of the nearest
+   elements along the axes */
+template <typename T, int D>
+inline auto star_stencil_nd(T center, T neighbour) {
+  return [&]<std::size_t... K, std::size_t... Dim>(std::index_sequence<K...>, std::index_sequence<Dim...>) {
+    return coef_nd<T, (int) (Dim * 0)...> { center }.toStencil()
+      + stencil_nd<T, star_coef_nd<T, K, Dim...>...> { std::tuple { star_coef_nd<T, K, Dim...> { neighbour }... } };
+  }(std::make_index_sequence<2 * D> {}, std::make_index_sequence<D> {});
+}
+
+template <typename T, int D, std::size_t K, std::size_t... Dim>
+using box_coef_nd = coef_nd<T, (int) (K / pow3_nd(D - 1 - Dim) % 3) - 1 ...>;
+
+// number of non-zero offsets of the K-th coef of a box stencil
+constexpr int box_distance_nd(int D, std::size_t K) {
+  int n = 0;
+  for (int k = 0; k < D; ++k, K /= 3)
+    n += K % 3 != 1;
+  return n;
+}
+
+/* The 3^D-point stencil, such as the 9-point 2D or 27-point 3D ones,
+   the coef of each element depending on its number of non-zero
+   offsets: coefs[0] for the center, coefs[1] for the faces, coefs[2]
+   for the edges and coefs[3] for the corners. The coefs are in the
+   row-major order of the offsets */
+template <typename T, int D>
+inline auto box_stencil_nd(std::array<T, D + 1> coefs) {
+  return [&]<std::size_t... K, std::size_t... Dim>(std::index_sequence<K...>, std::index_sequence<Dim...>) {
+    return stencil_nd<T, box_coef_nd<T, D, K, Dim...>...> {
+      std::tuple { box_coef_nd<T, D, K, Dim...> { coefs[box_distance_nd(D, K)] }... } };
+  }(std::make_index_sequence<pow3_nd(D)> {}, std::make_index_sequence<D> {});
+}
+
+// temporal blocking on host
+
+template <std::size_t D>
+constexpr int temporal_tile_side_nd(int size_of_T, std::array<int, D> d, int time_block) {
+  auto fits = [&] (int side) {
+    std::size_t size = 2 * size_of_T;
+    for (std::size_t k = 0; k < D; ++k)
+      size *= side + time_block * d[k];
+    return size <= J_HOST_L2_CACHE_SIZE;
+  };
+  int side = 1;
+  while (fits(side + 1))
+    ++side;
+  return side;
+}
+
+/* Size the cubic tiles for the temporal blocking, such that the 2 local
+   arrays of a tile with the halo needed by _time_block iterations fit
+   in the L2 cache */
+template <typename T, int D, std::array<int, D> d, int _time_block = J_HOST_TIME_BLOCK>
+class temporal_info_nd {
+  static constexpr std::array<int, D> dims(int side) {
+    std::array<int, D> a;
+    for (int k = 0; k < D; ++k)
+      a[k] = side + _time_block * d[k];
+    return a;
+  }
+
+  static constexpr std::array<std::ptrdiff_t, D> row_major(std::array<int, D> dims) {
+    std::array<std::ptrdiff_t, D> s;
+    std::ptrdiff_t stride = 1;
+    for (int k = D - 1; k >= 0; --k) {
+      s[k] = stride;
+      stride *= dims[k];
+    }
+    return s;
+  }
+
+public:
+  static const int time_block = _time_block;
+  static const int nbi_tile = temporal_tile_side_nd<D>(sizeof(T), d, time_block);
+  static constexpr std::array<int, D> local_dim = dims(nbi_tile);
+  static constexpr std::array<std::ptrdiff_t, D> strides = row_major(local_dim);
+  static const std::size_t local_size = strides[0] * local_dim[0];
+};
+
+// iterate on [lo, hi) in row-major order
+template <int D, class F>
+inline void for_each_nd(std::array<int, D> lo, std::array<int, D> hi, F f) {
+  for (int k = 0; k < D; ++k)
+    if (lo[k] >= hi[k])
+      return;
+  std::array<int, D> i = lo;
+  for (;;) {
+    f(i);
+    int k = D - 1;
+    while (k >= 0 && ++i[k] == hi[k]) {
+      i[k] = lo[k];
+      --k;
+    }
+    if (k < 0)
+      return;
+  }
+}
+
+
+template <typename T, int D, cl::sycl::buffer<T, D> *_aB>
+class input_nd {};
+
+template <typename T, int D, cl::sycl::buffer<T, D> *_B>
+class output_nd {};
+
+template <typename T, int D, cl::sycl::buffer<T, D> *B, class st, cl::sycl::buffer<T, D> *aB, int time_block = J_HOST_TIME_BLOCK>
+class operation_nd {
+  static constexpr std::array<int, D> sum(std::array<int, D> a, std::array<int, D> b) {
+    for (int k = 0; k < D; ++k)
+      a[k] += b[k];
+    return a;
+  }
+
+  static constexpr std::array<int, D> neg(std::array<int, D> a) {
+    for (int k = 0; k < D; ++k)
+      a[k] = -a[k];
+    return a;
+  }
+
+  static inline cl::sycl::id<D> to_id(std::array<int, D> i) {
+    cl::sycl::id<D> id;
+    for (int k = 0; k < D; ++k)
+      id[k] = i[k];
+    return id;
+  }
+
+public:
+  static_assert(std::is_base_of<auth_in_st_nd, st>::value, "An operation must be built with a stencil.");
+  static_assert(st::dimensions == D, "The stencil and the buffers must have the same dimension.");
+
+  // offsets and paddings for global memory
+  static constexpr std::array<int, D> of = neg(st::min_ind);
+  static constexpr std::array<int, D> pad = st::max_ind;
+  static constexpr std::array<int, D> d = sum(of, pad);
+
+  // tiles for temporal blocking on host
+  using ti = temporal_info_nd<T, D, d, time_block>;
+
+  // the size of the global arrays and of their inner part
+  std::array<int, D> size;
+  std::array<int, D> inner;
+  cl::sycl::range<D> range;
+
+  const st stencil;
+
+  operation_nd(st sten) : stencil(sten) {
+    cl::sycl::range<D> rg = aB->get_range();
+    for (int k = 0; k < D; ++k) {
+      size[k] = rg.get(k);
+      inner[k] = size[k] - d[k];
+      range[k] = inner[k];
+    }
+  }
+
+  inline void eval(cl::sycl::id<D> id, cl::sycl::accessor<T, D, cl::sycl::access::mode::write> out, cl::sycl::accessor<T, D, cl::sycl::access::mode::read> in) const {
+    for (int k = 0; k < D; ++k)
+      id[k] += of[k];
+    out[id] = stencil.eval(in, id);
+  }
+
+  inline void doComputation(cl::sycl::queue queue){
+    queue.submit([&](cl::sycl::handler &cgh) {
+        cl::sycl::accessor<T, D, cl::sycl::access::mode::write> _B {*B, cgh};
+        cl::sycl::accessor<T, D, cl::sycl::access::mode::read> _aB {*aB, cgh};
+        cgh.parallel_for<class KernelComputeND>(range,
+          [=, this] (cl::sycl::id<D> id) {
+            eval(id, _B, _aB);
+          });
+      });
+  }
+
+  /* Compute steps <= time_block iterations on a tile of the inner part,
+     like temporal_tile2D but in D dimensions. The innermost loop goes
+     along the contiguous dimension with a constant layout, so it can be
+     vectorized */
+  inline void temporal_tile(cl::sycl::id<D> tile, int steps, cl::sycl::accessor<T, D, cl::sycl::access::mode::write> out, cl::sycl::accessor<T, D, cl::sycl::access::mode::read> in) const {
+    std::vector<T> cur(ti::local_size);
+    std::vector<T> next(ti::local_size);
+    // global indices of the first element of the tile, of the local
+    // element 0 and extents of the tile and of the local array used
+    std::array<int, D> first, nb, org, ext;
+    for (int k = 0; k < D; ++k) {
+      first[k] = of[k] + tile[k] * ti::nbi_tile;
+      nb[k] = std::min<int>(ti::nbi_tile, inner[k] - tile[k] * ti::nbi_tile);
+      org[k] = first[k] - steps * of[k];
+      ext[k] = nb[k] + steps * d[k];
+    }
+    auto local = [] (std::array<int, D> l) {
+      return linear_nd(l, ti::strides);
+    };
+
+    std::array<int, D> lo, hi;
+    for (int k = 0; k < D; ++k) {
+      lo[k] = std::max(0, -org[k]);
+      hi[k] = std::min(ext[k], size[k] - org[k]);
+    }
+    for_each_nd<D>(lo, hi, [&] (std::array<int, D> l) {
+        cur[local(l)] = in[to_id(sum(org, l))];
+      });
+
+    for (int s = 1; s <= steps; ++s) {
+      // rows of the region computed at this step
+      for (int k = 0; k < D; ++k) {
+        lo[k] = s * of[k];
+        hi[k] = ext[k] - s * pad[k];
+      }
+      // the inner part, the ghost cells being constant
+      int first_inner = std::max(lo[D - 1], of[D - 1] - org[D - 1]);
+      int last_inner = std::min(hi[D - 1], of[D - 1] + inner[D - 1] - org[D - 1]);
+      auto row_hi = hi;
+      row_hi[D - 1] = lo[D - 1] + 1;
+      for_each_nd<D>(lo, row_hi, [&] (std::array<int, D> l) {
+          const T *c = &cur[local(l) - l[D - 1]];
+          T *n = &next[local(l) - l[D - 1]];
+          bool inner_row = true;
+          for (int k = 0; k < D - 1; ++k)
+            inner_row = inner_row && org[k] + l[k] >= of[k] && org[k] + l[k] < of[k] + inner[k];
+          if (!inner_row) {
+            std::copy(c + lo[D - 1], c + hi[D - 1], n + lo[D - 1]);
+            return;
+          }
+          std::copy(c + lo[D - 1], c + first_inner, n + lo[D - 1]);
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+          for (int j = first_inner; j < last_inner; ++j)
+            n[j] = stencil.template eval_local<ti::strides>(c + j);
+          std::copy(c + last_inner, c + hi[D - 1], n + last_inner);
+        });
+      std::swap(cur, next);
+    }
+
+    // write the tile, with the ghost cells along it on the border of the array
+    for (int k = 0; k < D; ++k) {
+      lo[k] = tile[k] == 0 ? 0 : first[k];
+      hi[k] = first[k] + nb[k] == of[k] + inner[k] ? size[k] : first[k] + nb[k];
+    }
+    for_each_nd<D>(lo, hi, [&] (std::array<int, D> g) {
+        bool in_tile = true;
+        for (int k = 0; k < D; ++k)
+          in_tile = in_tile && g[k] >= first[k] && g[k] < first[k] + nb[k];
+        auto id = to_id(g);
+        out[id] = in_tile ? cur[local(sum(g, neg(org)))] : in[id];
+      });
+  }
+
+  /* Do nb_iter iterations with temporal blocking on host, swapping the
+     buffers instead of copying back, so the last result is in *aB */
+  inline void doTemporalComputation(cl::sycl::queue queue, size_t nb_iter){
+    cl::sycl::range<D> tiles;
+    for (int k = 0; k < D; ++k)
+      tiles[k] = (inner[k] + ti::nbi_tile - 1) / ti::nbi_tile;
+    for (size_t done = 0; done < nb_iter; done += ti::time_block) {
+      int steps = std::min<size_t>(nb_iter - done, ti::time_block);
+      queue.submit([&](cl::sycl::handler &cgh) {
+          cl::sycl::accessor<T, D, cl::sycl::access::mode::write> _B {*B, cgh};
+          cl::sycl::accessor<T, D, cl::sycl::access::mode::read> _aB {*aB, cgh};
+          cgh.parallel_for<class KernelTemporalND>(tiles,
+            [=, *this] (cl::sycl::id<D> tile) {
+              temporal_tile(tile, steps, _B, _aB);
+            });
+        });
+      std::swap(*B, *aB);
+    }
+  }
+};
+
+
+template <typename T, int D, cl::sycl::buffer<T, D> *_B, class st>
+class output_stencil_nd {
+public:
+  const st stencil;
+  output_stencil_nd(st sten) : stencil(sten) {}
+};
+
+template <typename T, int D, cl::sycl::buffer<T, D> *B, class... C>
+inline output_stencil_nd<T, D, B, stencil_nd<T, C...>> operator<< (output_nd<T, D, B> out, stencil_nd<T, C...> in) {
+  return output_stencil_nd<T, D, B, stencil_nd<T, C...>> {in};
+}
+
+template <typename T, int D, cl::sycl::buffer<T, D> *B, class st, cl::sycl::buffer<T, D> *aB>
+inline operation_nd<T, D, B, st, aB> operator<< (output_stencil_nd<T, D, B, st> out, input_nd<T, D, aB> in) {
+  return operation_nd<T, D, B, st, aB> {out.stencil};
+}
+
+#endif
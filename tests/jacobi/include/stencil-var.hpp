@@ -129,6 +129,9 @@ public:
   static const int local_dim0 = li2D.nbi_wg0 + d0;
   static const int local_dim1 = li2D.nbi_wg1 + d1;
 
+  // tiles for temporal blocking on host
+  using ti2D = temporal_info2D<T, d0, d1>;
+
   cl::sycl::range<2> d = {d0, d1};
   cl::sycl::id<2> offset = {0, 0};
   cl::sycl::range<2> range;
@@ -256,6 +259,34 @@ public:
       });
   }
 
+  /* Do nb_iter iterations, using the output of each iteration as the
+     input of the next one, with temporal blocking on host. Instead of
+     copying the output back, the buffers are swapped after each group
+     of time_block iterations, so the last result is in *aB at the
+     end, as with a copy after each iteration. */
+  inline void doTemporalComputation(cl::sycl::queue queue, size_t nb_iter){
+    cl::sycl::range<2> tiles = {(size_t) (global_max0 + ti2D::nbi_tile0 - 1) / ti2D::nbi_tile0,
+                                (size_t) (global_max1 + ti2D::nbi_tile1 - 1) / ti2D::nbi_tile1};
+    for (size_t done = 0; done < nb_iter; done += ti2D::time_block) {
+      int steps = std::min<size_t>(nb_iter - done, ti2D::time_block);
+      queue.submit([&](cl::sycl::handler &cgh) {
+          cl::sycl::accessor<T, 2, cl::sycl::access::mode::write> _B {*B, cgh};
+          cl::sycl::accessor<T, 2, cl::sycl::access::mode::read> _aB {*aB, cgh};
+          cl::sycl::accessor<T, 1, cl::sycl::access::mode::read> _bB {*bB, cgh};
+          cgh.parallel_for<class KernelTemporal>(tiles,
+            [=, *this] (cl::sycl::id<2> tile) {
+              temporal_tile2D<ti2D, of0, of1, pad0, pad1, T>(tile, steps, global_max0, global_max1,
+                [&] (int i, int j) { return a_f(i, j, _aB); },
+                [&] (T *local, int i_local, int j_local, int i, int j) {
+                  return st::template eval_local<T, ti2D::local_dim1, b_f>(local, _bB, i, j, i_local, j_local);
+                },
+                [&] (int i, int j, T value) { f(i, j, _B) = value; });
+            });
+        });
+      std::swap(*B, *aB);
+    }
+  }
+
 
 };
 
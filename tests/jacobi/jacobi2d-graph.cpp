@@ -0,0 +1,158 @@
+/* RUN: %{execute}%s
+
+   The same Jacobi 2D as jacobi2d.cpp but with the 2 command groups of
+   an iteration recorded once in a command graph and replayed for each
+   iteration, to compare the submission overhead with direct submits
+ */
+
+// Jacobi
+#include "include/helpers-jacobi.hpp"
+
+// SYCL
+#include <CL/sycl.hpp>
+#include "triSYCL/vendor/triSYCL/graph.hpp"
+
+// ISO C++
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace cl;
+
+/// Submit the 2 command groups of a Jacobi iteration
+template <typename Buffer>
+void submit_iteration(sycl::queue &q, Buffer &ioABuffer, Buffer &ioBBuffer) {
+  q.submit([&](sycl::handler &cgh) {
+      sycl::accessor<float, 2, sycl::access::mode::read>  a(ioABuffer, cgh);
+      sycl::accessor<float, 2, sycl::access::mode::write> b(ioBBuffer, cgh);
+      cgh.parallel_for<class KernelCompute>(sycl::range<2> {M-2, N-2},
+                                            sycl::id<2> {1, 1},
+                                            [=] (sycl::item<2> it) {
+                             sycl::id<2> index = it.get_id();
+                             sycl::id<2> id1(sycl::range<2> {0,1});
+                             sycl::id<2> id2(sycl::range<2> {1,0});
+                             b[index] = a[index];
+                             b[index] += a[index+id1];
+                             b[index] += a[index+id2];
+                             b[index] += a[index-id1];
+                             b[index] += a[index-id2];
+                                              });
+    });
+  q.submit([&](sycl::handler &cgh) {
+      sycl::accessor<float, 2, sycl::access::mode::write> a(ioABuffer, cgh);
+      sycl::accessor<float, 2, sycl::access::mode::read>  b(ioBBuffer, cgh);
+      cgh.parallel_for<class KernelCopy>(sycl::range<2> {M-2, N-2},
+                                         sycl::id<2> {1, 1},
+                                         [=] (sycl::item<2> it) {
+                                           a[it] = MULT_COEF * b[it];
+                                         });
+    });
+}
+
+int main(int argc, char **argv)
+{
+    read_args(argc, argv);
+    counters timer;
+    start_measure(timer);
+
+    // declarations
+    sycl::buffer<float, 2> ioABuffer = cl::sycl::buffer<float, 2>(sycl::range<2> {M, N});
+    sycl::buffer<float, 2> ioBBuffer = sycl::buffer<float, 2>(sycl::range<2> {M, N});
+
+#if DEBUG_STENCIL
+    std::vector<float> a_test(M * N);
+    std::vector<float> b_test(M * N);
+#endif
+
+    // initialization
+    for (size_t i = 0; i < M; ++i)
+    {
+        for (size_t j = 0; j < N; ++j)
+        {
+            float value = ((float)i*(j + 2) + 10) / N;
+            sycl::id<2> id = { i, j };
+            ioABuffer.get_access<sycl::access::mode::write>()[id] = value;
+            ioBBuffer.get_access<sycl::access::mode::write>()[id] = value;
+#if DEBUG_STENCIL
+            a_test[i*N + j] = value;
+            b_test[i*N + j] = value;
+#endif
+        }
+    }
+
+  end_init(timer);
+
+  // compute result with "gpu"
+  {
+    sycl::queue myQueue;
+    // The graph has to be destroyed before the buffers it uses
+    sycl::vendor::trisycl::command_graph graph;
+
+    auto op_start = counters::clock_type::now();
+    graph.begin_recording(myQueue);
+    submit_iteration(myQueue, ioABuffer, ioBBuffer);
+    graph.end_recording();
+    graph.finalize();
+    auto op_end = counters::clock_type::now();
+    auto record_time =
+      std::chrono::duration_cast<std::chrono::microseconds>(op_end - op_start);
+
+    op_start = counters::clock_type::now();
+    for (unsigned int i = 0; i < NB_ITER; ++i)
+      graph.run(myQueue);
+    myQueue.wait();
+    timer.stencil_time = std::chrono::duration_cast<counters::duration_type>
+      (counters::clock_type::now() - op_start);
+
+    /* Compare the submission overheads on temporary buffers to keep
+       the result untouched, with enough submissions to be measurable */
+    constexpr int submissions = 100;
+    sycl::buffer<float, 2> tmpA { sycl::range<2> { M, N } };
+    sycl::buffer<float, 2> tmpB { sycl::range<2> { M, N } };
+    sycl::vendor::trisycl::command_graph tmp_graph;
+    tmp_graph.begin_recording(myQueue);
+    submit_iteration(myQueue, tmpA, tmpB);
+    tmp_graph.end_recording();
+    tmp_graph.finalize();
+    // Measure the submissions only, once the runtime is warmed up
+    auto submission_time = [&] (auto submit) {
+      submit();
+      myQueue.wait();
+      std::chrono::microseconds t;
+      {
+        /* Hold the data on the host while submitting, so the kernels
+           cannot start and steal the processors from the submission */
+        auto hold_a = tmpA.get_access<sycl::access::mode::write>();
+        auto hold_b = tmpB.get_access<sycl::access::mode::write>();
+        auto start = counters::clock_type::now();
+        for (int i = 0; i < submissions; ++i)
+          submit();
+        t = std::chrono::duration_cast<std::chrono::microseconds>
+          (counters::clock_type::now() - start);
+      }
+      myQueue.wait();
+      return t.count()/double(submissions);
+    };
+    auto replay_submit_time =
+      submission_time([&] { tmp_graph.run(myQueue); });
+    auto direct_submit_time =
+      submission_time([&] { submit_iteration(myQueue, tmpA, tmpB); });
+
+    std::cout << "Graph recording time: " << record_time.count() << " us"
+              << std::endl
+              << "Graph replay submission time per iteration: "
+              << replay_submit_time << " us" << std::endl
+              << "Direct submission time per iteration: "
+              << direct_submit_time << " us" << std::endl;
+  }
+
+  end_measure(timer);
+
+#if DEBUG_STENCIL
+  // get the gpu result
+  auto C = ioABuffer.get_access<sycl::access::mode::read>();
+  ute_and_are(a_test,b_test,C);
+#endif
+
+  return 0;
+}
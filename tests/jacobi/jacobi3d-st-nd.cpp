@@ -0,0 +1,183 @@
+/* RUN: %{execute}%s
+ */
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+#include "include/jacobi-stencil.hpp"
+
+// static declaration to use pointers
+cl::sycl::buffer<float,1> ioBuffer1;
+cl::sycl::buffer<float,1> ioABuffer1;
+cl::sycl::buffer<float,3> ioBuffer3;
+cl::sycl::buffer<float,3> ioABuffer3;
+
+// third dimension of the 3D problem
+size_t P = 34;
+
+template <int D>
+void init(cl::sycl::buffer<float,D> &b, cl::sycl::buffer<float,D> &a, std::vector<float> &ref) {
+  auto wb = b.template get_access<cl::sycl::access::mode::write>();
+  auto wa = a.template get_access<cl::sycl::access::mode::write>();
+  auto r = b.get_range();
+  for (size_t i = 0; i < r.size(); ++i) {
+    cl::sycl::id<D> id;
+    size_t l = i;
+    for (int k = D - 1; k >= 0; --k) {
+      id[k] = l % r[k];
+      l /= r[k];
+    }
+    float value = ((float) id[0]*(id[D - 1]+2) + 10) / r[D - 1];
+    wb[id] = wa[id] = ref[i] = value;
+  }
+}
+
+// hand-written reference of 1 iteration of a 3D stencil with the 3^3 coefs
+void reference3D(std::vector<float> &a, const std::array<float, 27> &coef) {
+  std::vector<float> b = a;
+  for (size_t i = 1; i < M - 1; ++i)
+    for (size_t j = 1; j < N - 1; ++j)
+      for (size_t k = 1; k < P - 1; ++k) {
+        float v = 0;
+        for (int c = 0; c < 27; ++c)
+          v += coef[c] * a[((i + c/9 - 1)*N + j + c/3%3 - 1)*P + k + c%3 - 1];
+        b[(i*N + j)*P + k] = v;
+      }
+  a = b;
+}
+
+template <int D>
+void check(cl::sycl::buffer<float,D> &a, const std::vector<float> &ref) {
+  auto C = a.template get_access<cl::sycl::access::mode::read>();
+  auto r = a.get_range();
+  for (size_t i = 0; i < r.size(); ++i) {
+    cl::sycl::id<D> id;
+    size_t l = i;
+    for (int k = D - 1; k >= 0; --k) {
+      id[k] = l % r[k];
+      l /= r[k];
+    }
+    float err = std::abs((C[id] - ref[i]) / ref[i]);
+    if (err > ERR_MAX) {
+      std::cout << "Wrong value " << C[id] << " on element " << i
+                << " (error : " << err << ")" << std::endl;
+      std::cout << "Programm exiting now." << std::endl;
+      exit(-1);
+    }
+  }
+}
+
+// run with 1 iteration per kernel and a copy, then with temporal blocking
+template <int D, class Op, class Copy>
+void run(Op op_work, Copy op_copy, cl::sycl::buffer<float,D> &b, cl::sycl::buffer<float,D> &a,
+         std::vector<float> &ref, counters &timer) {
+  std::vector<float> init_ref(ref.size());
+  init<D>(b, a, init_ref);
+  auto begin_op = counters::clock_type::now();
+  {
+    cl::sycl::queue myQueue;
+    for (unsigned int i = 0; i < NB_ITER; ++i){
+      op_work.doComputation(myQueue);
+      op_copy.doComputation(myQueue);
+    }
+    myQueue.wait();
+  }
+  auto end_op = counters::clock_type::now();
+  timer.stencil_time = std::chrono::duration_cast<counters::duration_type>(end_op - begin_op);
+  check<D>(a, ref);
+
+#if TEMPORAL_BLOCKING
+  timer.sweep_time = timer.stencil_time;
+  init<D>(b, a, init_ref);
+  begin_op = counters::clock_type::now();
+  {
+    cl::sycl::queue myQueue;
+    op_work.doTemporalComputation(myQueue, NB_ITER);
+    myQueue.wait();
+  }
+  end_op = counters::clock_type::now();
+  timer.stencil_time = std::chrono::duration_cast<counters::duration_type>(end_op - begin_op);
+  check<D>(a, ref);
+#endif
+}
+
+int main(int argc, char **argv) {
+  read_args(argc, argv);
+  std::cout << "Elements[2] : " << P << std::endl;
+
+  // 1D 3-point stencil
+  {
+    struct counters timer;
+    start_measure(timer);
+    ioBuffer1 = cl::sycl::buffer<float,1>(cl::sycl::range<1> {M*N});
+    ioABuffer1 = cl::sycl::buffer<float,1>(cl::sycl::range<1> {M*N});
+    std::vector<float> ref(M*N);
+    init<1>(ioBuffer1, ioABuffer1, ref);
+    for (unsigned int t = 0; t < NB_ITER; ++t) {
+      std::vector<float> b = ref;
+      for (size_t i = 1; i < M*N - 1; ++i)
+        b[i] = 0.5f*ref[i] + 0.25f*ref[i - 1] + 0.25f*ref[i + 1];
+      ref = b;
+    }
+
+    auto st = star_stencil_nd<float, 1>(0.5f, 0.25f);
+    input_nd<float, 1, &ioABuffer1> work_in;
+    output_nd<float, 1, &ioBuffer1> work_out;
+    auto op_work = work_out << st << work_in;
+    input_nd<float, 1, &ioBuffer1> copy_in;
+    output_nd<float, 1, &ioABuffer1> copy_out;
+    auto op_copy = copy_out << coef_nd<float, 0> {1.0f}.toStencil() << copy_in;
+    end_init(timer);
+    run<1>(op_work, op_copy, ioBuffer1, ioABuffer1, ref, timer);
+    std::cout << "1D 3-point:" << std::endl;
+    end_measure(timer);
+  }
+
+  // 3D 7-point and 27-point stencils
+  ioBuffer3 = cl::sycl::buffer<float,3>(cl::sycl::range<3> {M, N, P});
+  ioABuffer3 = cl::sycl::buffer<float,3>(cl::sycl::range<3> {M, N, P});
+  input_nd<float, 3, &ioABuffer3> work_in;
+  output_nd<float, 3, &ioBuffer3> work_out;
+  input_nd<float, 3, &ioBuffer3> copy_in;
+  output_nd<float, 3, &ioABuffer3> copy_out;
+  auto op_copy = copy_out << coef_nd<float, 0, 0, 0> {1.0f}.toStencil() << copy_in;
+
+  std::array<float, 27> coef7 {};
+  for (int c : { 4, 10, 12, 13, 14, 16, 22 })
+    coef7[c] = 1.0f/7;
+  std::array<float, 4> by_distance = { 0.25f, 0.05f, 0.025f, 0.0125f };
+  std::array<float, 27> coef27;
+  for (int c = 0; c < 27; ++c)
+    coef27[c] = by_distance[(c/9 != 1) + (c/3%3 != 1) + (c%3 != 1)];
+
+  {
+    struct counters timer;
+    start_measure(timer);
+    std::vector<float> ref(M*N*P);
+    init<3>(ioBuffer3, ioABuffer3, ref);
+    for (unsigned int t = 0; t < NB_ITER; ++t)
+      reference3D(ref, coef7);
+    auto op_work = work_out << star_stencil_nd<float, 3>(1.0f/7, 1.0f/7) << work_in;
+    end_init(timer);
+    run<3>(op_work, op_copy, ioBuffer3, ioABuffer3, ref, timer);
+    std::cout << "3D 7-point:" << std::endl;
+    end_measure(timer);
+  }
+
+  {
+    struct counters timer;
+    start_measure(timer);
+    std::vector<float> ref(M*N*P);
+    init<3>(ioBuffer3, ioABuffer3, ref);
+    for (unsigned int t = 0; t < NB_ITER; ++t)
+      reference3D(ref, coef27);
+    auto op_work = work_out << box_stencil_nd<float, 3>(by_distance) << work_in;
+    end_init(timer);
+    run<3>(op_work, op_copy, ioBuffer3, ioABuffer3, ref, timer);
+    std::cout << "3D 27-point:" << std::endl;
+    end_measure(timer);
+  }
+
+  std::cout << "ok" << std::endl;
+  return 0;
+}
@@ -0,0 +1,83 @@
+/* RUN: %{execute}%s
+
+   Test the asynchronous copies between global and local memory
+*/
+#include <CL/sycl.hpp>
+
+#include <numeric>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cl::sycl;
+
+constexpr size_t N = 64;
+constexpr size_t WG = 16;
+
+TEST_CASE("async_work_group_copy with nd_item", "[nd_item]") {
+  buffer<int> a { N };
+  buffer<int> b { N };
+  {
+    auto a_a = a.get_access<access::mode::discard_write>();
+    std::iota(a_a.begin(), a_a.end(), 0);
+  }
+  queue q;
+  q.submit([&](handler &cgh) {
+    auto a_a = a.get_access<access::mode::read>(cgh);
+    auto a_b = b.get_access<access::mode::discard_write>(cgh);
+    accessor<int, 1, access::mode::read_write, access::target::local>
+      tile { WG, cgh };
+    cgh.parallel_for<class staging>(nd_range<1> { N, WG },
+                                    [=](nd_item<1> it) {
+      auto offset = it.get_group(0)*WG;
+      it.prefetch(global_ptr<int> { &a_a[offset] }, WG);
+      auto e = it.async_work_group_copy(local_ptr<int> { &tile[0] },
+                                        global_ptr<int> { &a_a[offset] },
+                                        WG);
+      it.wait_for(e);
+      // Each work-item updates its element of the tile
+      tile[it.get_local_id(0)] *= 2;
+      // The whole tile has to be updated before copying it back
+      it.barrier(access::fence_space::local_space);
+      it.wait_for(it.async_work_group_copy(global_ptr<int> { &a_b[offset] },
+                                           local_ptr<int> { &tile[0] },
+                                           WG));
+    });
+  });
+  auto a_b = b.get_access<access::mode::read>();
+  for (size_t i = 0; i < N; ++i)
+    REQUIRE(a_b[i] == 2*i);
+}
+
+
+TEST_CASE("strided async_work_group_copy with group", "[group]") {
+  // Transpose a N/WG x WG matrix through the local memory
+  buffer<int> a { N };
+  buffer<int> b { N };
+  {
+    auto a_a = a.get_access<access::mode::discard_write>();
+    std::iota(a_a.begin(), a_a.end(), 0);
+  }
+  queue q;
+  q.submit([&](handler &cgh) {
+    auto a_a = a.get_access<access::mode::read>(cgh);
+    auto a_b = b.get_access<access::mode::discard_write>(cgh);
+    accessor<int, 1, access::mode::read_write, access::target::local>
+      column { N/WG, cgh };
+    cgh.parallel_for_work_group<class transpose>(
+      nd_range<1> { WG, 1 }, [=](group<1> g) {
+        auto j = g.get_id(0);
+        // Gather column j of the input with a stride of a row
+        g.wait_for(g.async_work_group_copy(local_ptr<int> { &column[0] },
+                                           global_ptr<int> { &a_a[j] },
+                                           N/WG, WG));
+        // Store it as row j of the output
+        g.wait_for(g.async_work_group_copy(global_ptr<int> { &a_b[j*(N/WG)] },
+                                           local_ptr<int> { &column[0] },
+                                           N/WG));
+      });
+  });
+  auto a_b = b.get_access<access::mode::read>();
+  for (size_t j = 0; j < WG; ++j)
+    for (size_t i = 0; i < N/WG; ++i)
+      REQUIRE(a_b[j*(N/WG) + i] == i*WG + j);
+}
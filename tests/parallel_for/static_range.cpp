@@ -0,0 +1,72 @@
+/* RUN: %{execute}%s
+
+   Check the parallel_for on a static_range<> known at compile time
+*/
+#include <sycl/sycl.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace sycl;
+
+TEST_CASE("static_range properties", "[parallel_for]") {
+  using r = static_range<4, 8, 16>;
+  STATIC_REQUIRE(r::dimensions == 3);
+  STATIC_REQUIRE(r::rank() == 3);
+  STATIC_REQUIRE(r::get(2) == 16);
+  STATIC_REQUIRE(r::size() == 512);
+  range<3> dynamic = r {};
+  REQUIRE(dynamic == range<3> { 4, 8, 16 });
+}
+
+
+TEST_CASE("parallel_for on a 1D static_range", "[parallel_for]") {
+  constexpr std::size_t size = 1000;
+  queue q;
+  buffer<int> b { size };
+  q.submit([&](handler& cgh) {
+    auto a = b.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for(static_range<size> {}, [=](id<1> i) { a[i] = 2*i[0]; });
+  });
+  auto a = b.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < size; ++i)
+    REQUIRE(a[i] == 2*i);
+}
+
+
+TEST_CASE("parallel_for on a 2D static_range with items", "[parallel_for]") {
+  constexpr std::size_t rows = 31;
+  constexpr std::size_t columns = 64;
+  queue q;
+  buffer<int, 2> b { { rows, columns } };
+  q.submit([&](handler& cgh) {
+    auto a = b.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for(static_range<rows, columns> {}, [=](item<2> i) {
+      a[i] = i[0]*columns + i[1];
+      // The range of the item is the static one
+      if (i.get_range() != range<2> { rows, columns })
+        a[i] = -1;
+    });
+  });
+  auto a = b.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < rows; ++i)
+    for (std::size_t j = 0; j < columns; ++j)
+      REQUIRE(a[i][j] == i*columns + j);
+}
+
+
+TEST_CASE("parallel_for on a 3D static_range", "[parallel_for]") {
+  queue q;
+  buffer<int, 3> b { { 3, 5, 7 } };
+  q.submit([&](handler& cgh) {
+    auto a = b.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for<class static_3d>(static_range<3, 5, 7> {},
+                                      [=](id<3> i) {
+      a[i] = 100*i[0] + 10*i[1] + i[2];
+    });
+  });
+  auto a = b.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < 3; ++i)
+    for (std::size_t j = 0; j < 5; ++j)
+      for (std::size_t k = 0; k < 7; ++k)
+        REQUIRE(a[i][j][k] == 100*i + 10*j + k);
+}
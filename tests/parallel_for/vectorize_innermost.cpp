@@ -0,0 +1,77 @@
+/* RUN: %{execute}%s
+
+   Check the parallel_for on a range<> with the innermost dimension
+   run as a vectorizable loop
+*/
+#define TRISYCL_VECTORIZE_INNERMOST
+
+#include <sycl/sycl.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace sycl;
+
+TEST_CASE("1D element-wise kernel", "[parallel_for]") {
+  constexpr std::size_t size = 1003;
+  queue q;
+  buffer<float> a { size };
+  buffer<float> b { size };
+  {
+    auto h = a.get_access<access::mode::discard_write>();
+    for (std::size_t i = 0; i < size; ++i)
+      h[i] = i;
+  }
+  q.submit([&](handler& cgh) {
+    auto ka = a.get_access<access::mode::read>(cgh);
+    auto kb = b.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for(range<1> { size }, [=](id<1> i) { kb[i] = 2*ka[i] + 1; });
+  });
+  auto h = b.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < size; ++i)
+    REQUIRE(h[i] == 2*i + 1);
+}
+
+
+TEST_CASE("2D kernel with items", "[parallel_for]") {
+  constexpr std::size_t rows = 17;
+  constexpr std::size_t columns = 67;
+  queue q;
+  buffer<int, 2> b { { rows, columns } };
+  q.submit([&](handler& cgh) {
+    auto a = b.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for(range<2> { rows, columns }, [=](item<2> i) {
+      a[i] = i[0]*columns + i[1];
+    });
+  });
+  auto a = b.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < rows; ++i)
+    for (std::size_t j = 0; j < columns; ++j)
+      REQUIRE(a[i][j] == static_cast<int>(i*columns + j));
+}
+
+
+TEST_CASE("3D kernels on range<> and static_range<>", "[parallel_for]") {
+  queue q;
+  buffer<int, 3> b { { 3, 5, 7 } };
+  buffer<int, 3> s { { 3, 5, 7 } };
+  q.submit([&](handler& cgh) {
+    auto a = b.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for(range<3> { 3, 5, 7 }, [=](id<3> i) {
+      a[i] = 100*i[0] + 10*i[1] + i[2];
+    });
+  });
+  q.submit([&](handler& cgh) {
+    auto a = s.get_access<access::mode::discard_write>(cgh);
+    cgh.parallel_for(static_range<3, 5, 7> {}, [=](id<3> i) {
+      a[i] = 100*i[0] + 10*i[1] + i[2];
+    });
+  });
+  auto ab = b.get_access<access::mode::read>();
+  auto as = s.get_access<access::mode::read>();
+  for (std::size_t i = 0; i < 3; ++i)
+    for (std::size_t j = 0; j < 5; ++j)
+      for (std::size_t k = 0; k < 7; ++k) {
+        REQUIRE(ab[i][j][k] == static_cast<int>(100*i + 10*j + k));
+        REQUIRE(as[i][j][k] == static_cast<int>(100*i + 10*j + k));
+      }
+}
@@ -0,0 +1,70 @@
+/* RUN: %{execute}%s
+
+   Run the stages of a dataflow region connected by pipes concurrently
+   on host
+*/
+#include <CL/sycl.hpp>
+
+#include <atomic>
+#include <numeric>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cl::sycl;
+
+// Number of values going through the dataflow
+constexpr int N = 100;
+
+// Set by the first stage once it has written all the values
+std::atomic<bool> producer_done = false;
+
+// Whether the last stage got its first value before the first stage ended
+std::atomic<bool> consumed_while_producing = false;
+
+/// The pipes between the stages, much smaller than the data
+using input_pipe = cl::sycl::pipe<class input_fifo, int, 4>;
+using output_pipe = cl::sycl::pipe<class output_fifo, int, 4>;
+
+TEST_CASE("dataflow stages overlap on host", "[pipe]") {
+  buffer<int> a { N };
+  buffer<int> b { N };
+  {
+    host_accessor a_b { b };
+    std::iota(a_b.begin(), a_b.end(), 0);
+  }
+
+  queue {}.submit([&] (handler &cgh) {
+      accessor a_a { a, cgh };
+      accessor a_b { b, cgh };
+      cgh.single_task([=] {
+          vendor::xilinx::dataflow(
+            [&] {
+              for (int i = 0; i < N; ++i)
+                input_pipe::write(a_b[i]);
+              producer_done = true;
+            },
+            [&] {
+              for (int i = 0; i < N; ++i) {
+                auto v = input_pipe::read();
+                output_pipe::write(3*v);
+              }
+            },
+            [&] {
+              for (int i = 0; i < N; ++i) {
+                auto v = output_pipe::read();
+                if (i == 0)
+                  consumed_while_producing = !producer_done;
+                a_a[i] = v;
+              }
+            });
+        });
+    }).wait();
+
+  host_accessor a_a { a };
+  for (int i = 0; i < N; ++i)
+    REQUIRE(a_a[i] == 3*i);
+  /* The 3 stages overlap instead of running in sequence: the pipes
+     are much smaller than the data, so the first stage can only end
+     after the last one has started consuming */
+  REQUIRE(consumed_while_producing);
+}
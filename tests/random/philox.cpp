@@ -0,0 +1,105 @@
+/* RUN: %{execute}%s
+
+   Exercise triSYCL sycl::vendor::trisycl::random::philox4x32 extension
+*/
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <triSYCL/vendor/triSYCL/random/philox.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace r = trisycl::vendor::trisycl::random;
+
+using philox = r::philox4x32<>;
+
+TEST_CASE("philox known answers", "[random]") {
+  // From the known-answer tests of the Random123 library
+  REQUIRE((philox::block({ 0, 0, 0, 0 }, { 0, 0 })
+           == philox::counter_type { 0x6627e8d5, 0xe169c58d,
+                                     0xbc57ac4c, 0x9b00dbd8 }));
+  REQUIRE((philox::block({ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+                         { 0xffffffff, 0xffffffff })
+           == philox::counter_type { 0x408f276d, 0x41c83b0e,
+                                     0xa20bc7c6, 0x6d5451fd }));
+  REQUIRE((philox::block({ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 },
+                         { 0xa4093822, 0x299f31d0 })
+           == philox::counter_type { 0xd16cfe09, 0x94fdcceb,
+                                     0x5001e420, 0x24126ea1 }));
+  // It can be computed at compile time
+  static_assert(philox::block({ 0, 0, 0, 0 }, { 0, 0 })[0] == 0x6627e8d5);
+}
+
+TEST_CASE("philox generate and discard", "[random]") {
+  philox reference { 42, 3 };
+  std::vector<std::uint32_t> expected(1003);
+  for (auto& e : expected)
+    e = reference();
+
+  philox g { 42, 3 };
+  std::vector<std::uint32_t> v(1003);
+  // Start in the middle of a block and end with a partial block
+  v[0] = g();
+  g.generate(std::span { v }.subspan(1));
+  REQUIRE(v == expected);
+
+  for (std::uint64_t n : { 0, 1, 2, 3, 4, 5, 7, 8, 9, 100, 997 }) {
+    philox d { 42, 3 };
+    d();
+    d.discard(n);
+    REQUIRE(d() == expected[n + 1]);
+  }
+
+  // Another stream or another seed give other values
+  REQUIRE(philox { 42, 4 }() != expected[0]);
+  REQUIRE(philox { 43, 3 }() != expected[0]);
+}
+
+TEST_CASE("philox streams of work-items", "[random]") {
+  constexpr std::size_t size = 1024;
+  constexpr int draws = 10;
+  sycl::buffer<std::uint32_t, 2> b { { size, draws } };
+  sycl::queue {}.submit([&](sycl::handler& cgh) {
+    sycl::accessor a { b, cgh };
+    cgh.parallel_for(sycl::range<1> { size }, [=](sycl::item<1> i) {
+      philox g { 2021, i };
+      for (int d = 0; d < draws; ++d)
+        a[i[0]][d] = g();
+    });
+  });
+  sycl::host_accessor a { b };
+  for (std::size_t i = 0; i < size; ++i) {
+    philox g { 2021, i };
+    for (int d = 0; d < draws; ++d)
+      REQUIRE(a[i][d] == g());
+  }
+  // The streams are not correlated, so no value should repeat
+  std::vector<std::uint32_t> all(&a[0][0], &a[0][0] + size*draws);
+  std::ranges::sort(all);
+  REQUIRE(std::ranges::adjacent_find(all) == all.end());
+}
+
+TEST_CASE("philox batch generation", "[random]") {
+  std::vector<std::uint32_t> v(1 << 22);
+  using clk = std::chrono::high_resolution_clock;
+  philox g;
+  auto start = clk::now();
+  for (auto& e : v)
+    e = g();
+  std::chrono::duration<double> one = clk::now() - start;
+  auto last = v.back();
+  philox batch;
+  start = clk::now();
+  batch.generate(v);
+  std::chrono::duration<double> all = clk::now() - start;
+  REQUIRE(v.back() == last);
+  std::cout << "philox4x32: " << v.size()/one.count()/1e6
+            << " M values/s one at a time, " << v.size()/all.count()/1e6
+            << " M values/s with generate()" << std::endl;
+}
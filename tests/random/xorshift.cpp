@@ -2,9 +2,11 @@
 
    Exercise triSYCL sycl::vendor::trisycl::random::xorshift extension
 */
+#include <cstdint>
 #include <iostream>
 #include <random>
 #include <type_traits>
+#include <vector>
 
 #include <triSYCL/vendor/triSYCL/random/xorshift.hpp>
 
@@ -52,3 +54,44 @@ TEST_CASE("xorshift", "[random]") {
   for (int n = 0; n < 10; ++n)
         std::cout << rdist(rng32) << '\n';
 }
+
+template <int N> void check_jump_ahead() {
+  r::xorshift<N> g;
+  std::vector<typename r::xorshift<N>::result_type> expected(1000);
+  for (auto& e : expected)
+    e = g();
+  for (std::uint64_t n : { 0, 1, 2, 31, 64, 127, 500, 999 }) {
+    r::xorshift<N> d;
+    d.discard(n);
+    REQUIRE(d() == expected[n]);
+  }
+
+  // Compare with a long but feasible sequential run
+  constexpr std::uint64_t far = 3'000'017;
+  r::xorshift<N> s;
+  for (std::uint64_t i = 0; i != far; ++i)
+    s();
+  r::xorshift<N> d;
+  d.discard(far);
+  REQUIRE(d.state == s.state);
+
+  // jump() advances by 2^(N/2) steps, which is done by 2 discards
+  r::xorshift<N> j;
+  j.jump();
+  r::xorshift<N> k;
+  k.discard(std::uint64_t { 1 } << (N/4));
+  k.discard(((std::uint64_t { 1 } << (N/2 - N/4)) - 1) << (N/4));
+  REQUIRE(j.state == k.state);
+  REQUIRE(j.state != r::xorshift<N> {}.state);
+
+  r::xorshift<N> b;
+  std::vector<typename r::xorshift<N>::result_type> v(expected.size());
+  b.generate(v);
+  REQUIRE(v == expected);
+}
+
+TEST_CASE("xorshift jump-ahead", "[random]") {
+  check_jump_ahead<32>();
+  check_jump_ahead<64>();
+  check_jump_ahead<128>();
+}
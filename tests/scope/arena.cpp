@@ -0,0 +1,97 @@
+/* RUN: %{execute}%s
+
+   Check the placement of the scope storage in the memory arenas of
+   the devices and platforms
+*/
+#include <CL/sycl.hpp>
+
+#include "triSYCL/vendor/triSYCL/scope.hpp"
+
+#include <cstdint>
+#include <memory>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cl::sycl;
+namespace scope = cl::sycl::vendor::trisycl::scope;
+
+// Some small storage updated by the kernels
+struct counter {
+  int value = 0;
+};
+
+// A large lookup table kept in device scope
+struct lookup_table {
+  static constexpr int size = 1 << 20;
+  int table[size];
+};
+
+TEST_CASE("cache-line padding", "[scope]") {
+  scope::device<counter> d1;
+  scope::device<counter> d2;
+  // The scoped devices on the same SYCL device share the arena
+  REQUIRE(&d1.get_arena() == &d2.get_arena());
+  auto line = scope::detail::arena::cache_line;
+  REQUIRE(reinterpret_cast<std::uintptr_t>(&d1.get_storage()) % line == 0);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(&d2.get_storage()) % line == 0);
+  REQUIRE(d1.get_storage().value == 0);
+  REQUIRE(d1.get_arena().shared_cache_lines() == 0);
+}
+
+
+TEST_CASE("packed storage sharing cache lines", "[scope]") {
+  scope::device<counter, scope::empty_platform_scope, scope::padding::packed>
+    d1;
+  scope::device<counter, scope::empty_platform_scope, scope::padding::packed>
+    d2;
+  auto distance = reinterpret_cast<char *>(&d2.get_storage())
+    - reinterpret_cast<char *>(&d1.get_storage());
+  REQUIRE(distance == sizeof(counter));
+  // This is where the kernels updating d1 and d2 would fight for a line
+  REQUIRE(d1.get_arena().shared_cache_lines() == 1);
+}
+
+
+TEST_CASE("lookup table in device scope", "[scope]") {
+  scope::platform<counter> p;
+  REQUIRE(reinterpret_cast<std::uintptr_t>(&p.get_storage())
+          % scope::detail::arena::cache_line == 0);
+  auto q = scope::queue {
+    scope::device<lookup_table, decltype(p)> { {}, p } };
+  auto &lut = q.device_scope();
+  if (TRISYCL_SCOPE_HUGE_PAGES)
+    REQUIRE(q.get_device().get_arena().has_huge_pages());
+  for (int i = 0; i < lookup_table::size; ++i)
+    lut.table[i] = 3*i;
+
+  constexpr int size = 1000;
+  buffer<int> b { size };
+  q.submit([&] (auto &cgh) {
+      auto ab = b.get_access<access::mode::discard_write>(cgh);
+      cgh.template parallel_for<class lookup>(range<1> { size },
+                                              [=] (id<1> i, auto &kh) {
+          ab[i] = kh.device_scope().table[i[0]*1000];
+        });
+    });
+  auto ab = b.get_access<access::mode::read>();
+  for (int i = 0; i < size; ++i)
+    REQUIRE(ab[i] == 3000*i);
+}
+
+
+TEST_CASE("the arena registry does not keep anything alive", "[scope]") {
+  // Something owning an implementation like a device or a platform
+  struct owner {
+    std::shared_ptr<int> implementation = std::make_shared<int>();
+  } o;
+  std::weak_ptr<int> implementation = o.implementation;
+  auto a = scope::detail::arena::of(o);
+  REQUIRE(a == scope::detail::arena::of(o));
+  std::weak_ptr<scope::detail::arena> w = a;
+  a.reset();
+  REQUIRE(w.expired());
+  // A new arena is created once the previous one is released
+  REQUIRE(scope::detail::arena::of(o));
+  o.implementation.reset();
+  REQUIRE(implementation.expired());
+}
@@ -0,0 +1,60 @@
+/* RUN: %{execute}%s
+
+   Exercise the unified shared memory with explicit and pointer-based
+   dependencies
+*/
+#include <sycl/sycl.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+constexpr std::size_t N = 1000;
+
+TEST_CASE("USM allocation kinds", "[usm]") {
+  sycl::queue q;
+  auto d = sycl::malloc_device<int>(N, q);
+  auto h = sycl::malloc_host<int>(N, q);
+  auto s = sycl::malloc_shared<int>(N, q);
+  REQUIRE(sycl::get_pointer_type(d, q.get_context()) == sycl::usm::alloc::device);
+  REQUIRE(sycl::get_pointer_type(h + 10, q.get_context())
+          == sycl::usm::alloc::host);
+  REQUIRE(sycl::get_pointer_type(s + N - 1, q.get_context())
+          == sycl::usm::alloc::shared);
+  int i;
+  REQUIRE(sycl::get_pointer_type(&i, q.get_context()) == sycl::usm::alloc::unknown);
+  sycl::free(d, q);
+  // The pool recycles the freed memory for the same size class
+  auto d2 = sycl::malloc_device<int>(N, q);
+  REQUIRE(d2 == d);
+  sycl::free(d2, q);
+  sycl::free(h, q);
+  sycl::free(s, q);
+  REQUIRE(sycl::malloc_shared<int>(0, q) == nullptr);
+}
+
+TEST_CASE("USM commands and kernels", "[usm]") {
+  sycl::queue q;
+  auto a = sycl::malloc_shared<int>(N, q);
+  auto b = sycl::malloc_device<int>(N, q);
+
+  // The copy depends on the fill through the pointers
+  q.fill(a, 3, N);
+  auto copied = q.memcpy(b, a, N * sizeof(int));
+  /* A kernel only depends on the events it is given, since the pointers
+     it captures are not visible */
+  auto e = q.parallel_for(sycl::range<1> { N }, [=](sycl::id<1> i) {
+    b[i[0]] += i[0];
+  }, copied);
+  // Explicit dependency on the kernel through the event
+  q.submit([&](sycl::handler &cgh) {
+    cgh.depends_on(e);
+    cgh.copy(b, a, N);
+  }).wait();
+  for (std::size_t i = 0; i < N; ++i)
+    REQUIRE(a[i] == 3 + static_cast<int>(i));
+
+  q.memset(a, 0, N * sizeof(int)).wait();
+  REQUIRE(a[N - 1] == 0);
+
+  sycl::free(a, q);
+  sycl::free(b, q);
+}